@@ -0,0 +1,103 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+// The constexpr angle math in util.hpp against the loop based versions it replaced.  Every pair of current and
+// target on a grid has to give exactly the same answer, including +-180, multiples of 360 and huge imu values.
+// Grid values are multiples of 1/8 so the old loops add and subtract 360 exactly.
+
+#include <cmath>
+#include <vector>
+
+#include "EZ-Template/util.hpp"
+#include "bench.hpp"
+
+using namespace ez;
+
+static int sgn(double input) { return input > 0 ? 1 : (input < 0 ? -1 : 0); }
+
+// As they were before util.hpp made them constexpr
+static double old_wrap_angle(double theta) {
+  while (theta > 180) theta -= 360;
+  while (theta < -180) theta += 360;
+  return theta;
+}
+
+static double old_turn_shortest(double target, double current) {
+  double error = target - current;
+  if (fabs(error) < 180.0) return target;
+  double new_target = target;
+  while (error > 180) {
+    new_target -= 360;
+    error = new_target - current;
+  }
+  while (error < -180) {
+    new_target += 360;
+    error = new_target - current;
+  }
+  if (new_target - current == 0.0) return current;
+  return new_target;
+}
+
+static double old_turn_longest(double target, double current) {
+  double shortest_target = old_turn_shortest(target, current);
+  return shortest_target - (360 * sgn(shortest_target - current));
+}
+
+static double old_turn_left(double target, double current) {
+  double shortest = old_turn_shortest(target, current);
+  if (sgn(shortest - current) == -1) return shortest;
+  return old_turn_longest(target, current);
+}
+
+static double old_turn_right(double target, double current) {
+  double shortest = old_turn_shortest(target, current);
+  if (sgn(shortest - current) == 1) return shortest;
+  return old_turn_longest(target, current);
+}
+
+int main() {
+  // Every 7.5 degrees for two turns each way, the boundaries and just past them, then the same spots after
+  // thousands of accumulated turns
+  std::vector<double> angles;
+  for (double i = -720.0; i <= 720.0; i += 7.5) angles.push_back(i);
+  for (double i : {180.0, 540.0, 360.0, 179.875, 180.125, 539.875, 540.125, 0.125})
+    angles.insert(angles.end(), {i, -i});
+  std::vector<double> currents = angles;
+  for (double turns : {1000.0, 100000.0})
+    for (double i : {0.0, 90.0, 180.0, 179.875, 180.125, 359.875})
+      currents.insert(currents.end(), {(360.0 * turns) + i, (-360.0 * turns) - i});
+
+  int checked = 0, failed = 0;
+  auto check = [&](const char* name, double got, double expected, double target, double current) {
+    checked++;
+    if (got == expected) return;
+    if (failed++ < 10) printf("  %s(%.3f, %.3f) is %.3f, expected %.3f\n", name, target, current, got, expected);
+  };
+  for (double current : currents) {
+    check("wrap_angle", util::wrap_angle(current), old_wrap_angle(current), current, 0.0);
+    for (double target : angles) {
+      check("angle_shortest", util::angle_shortest(target, current), old_turn_shortest(target, current), target, current);
+      check("angle_longest", util::angle_longest(target, current), old_turn_longest(target, current), target, current);
+      check("angle_left", util::angle_left(target, current), old_turn_left(target, current), target, current);
+      check("angle_right", util::angle_right(target, current), old_turn_right(target, current), target, current);
+    }
+  }
+  printf("angle math, %i pairs checked against the old loops, %i wrong\n", checked, failed);
+
+  // The old loops get slower the more the imu has turned, the new math doesn't
+  const int CALLS = 100000;
+  for (double turns : {0.0, 10.0, 1000.0}) {
+    double current = (360.0 * turns) + 45.0;
+    double before = bench::time_ns(CALLS, [&](int i) { bench::sink = bench::sink + old_turn_shortest(i % 360, current); });
+    double after = bench::time_ns(CALLS, [&](int i) { bench::sink = bench::sink + util::angle_shortest(i % 360, current); });
+    char name[64];
+    snprintf(name, sizeof(name), "shortest, %.0f turns", turns);
+    bench::report(name, before, after);
+  }
+
+  printf(failed == 0 ? "  pass\n" : "  FAIL, the new angle math doesn't match the old loops\n");
+  return failed == 0 ? 0 : 1;
+}
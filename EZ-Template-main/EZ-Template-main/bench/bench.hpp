@@ -0,0 +1,45 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace bench {
+// Same numbers every run so results can be compared between commits
+struct random {
+  std::uint64_t state = 0x2545F4914F6CDD1DULL;
+  double next(double min, double max) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return min + ((max - min) * ((state >> 11) * (1.0 / 9007199254740992.0)));
+  }
+};
+
+// Runs function reps times and returns nanoseconds per call, the best of a few tries so other processes matter less
+template <class Function>
+double time_ns(int reps, Function function) {
+  double best = 1e18;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) function(i);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / reps;
+    if (ns < best) best = ns;
+  }
+  return best;
+}
+
+// Keeps the compiler from throwing away work whose result isn't otherwise used
+inline volatile double sink = 0.0;
+
+inline void report(const char* name, double before_ns, double after_ns) {
+  printf("  %-28s before %8.2f ns   after %8.2f ns   %.2fx\n", name, before_ns, after_ns, before_ns / after_ns);
+}
+}  // namespace bench
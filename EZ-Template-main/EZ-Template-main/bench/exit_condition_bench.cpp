@@ -0,0 +1,96 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+// Cost of the mA check in PID::exit_condition() per call, motors copied into a vector every call against motors
+// bound once with exit_condition_motors_set().  Drive motions used to call exit_condition({left, right}) every tick.
+
+#include <vector>
+
+#include "bench.hpp"
+#include "pros/motors.hpp"
+
+// pros::Motor can only be built against the PROS kernel.  This stands in for it with the same size and a vtable, so
+// copying it costs the same, and is_over_current() isn't inlined, like the kernel call it stands in for
+struct motor {
+  motor(int port) : port(port) {}
+  virtual ~motor() = default;
+  __attribute__((noinline)) bool is_over_current() const { return over_current[port & 31]; }
+  int get_port() const { return port; }
+
+  static inline volatile bool over_current[32] = {};
+  int port;
+  char padding[sizeof(pros::Motor) - sizeof(void*) - sizeof(int)];
+};
+static_assert(sizeof(motor) == sizeof(pros::Motor));
+
+// A motor group only keeps ports, like pros::MotorGroup
+struct motor_group {
+  std::vector<std::int8_t> ports;
+  int size() const { return ports.size(); }
+  int get_port(int index) const { return ports[index]; }
+  __attribute__((noinline)) bool is_over_current(int index) const { return motor::over_current[ports[index] & 31]; }
+};
+
+// The mA part of exit_condition() before motors could be bound, the vector is taken by value and each motor copied
+__attribute__((noinline)) static bool old_vector(std::vector<motor> sensor) {
+  for (auto i : sensor)
+    if (i.is_over_current()) return true;
+  return false;
+}
+
+__attribute__((noinline)) static bool old_group(const motor_group& sensor) {
+  std::vector<motor> vector_sensor;
+  for (int i = 0; i < sensor.size(); i++) vector_sensor.push_back(motor(sensor.get_port(i)));
+  return old_vector(vector_sensor);
+}
+
+// After, motors are bound once and checked where they are
+struct pid {
+  std::vector<motor> current_motors;
+  void exit_condition_motors_set(const std::vector<motor>& sensor) {
+    current_motors.clear();
+    current_motors.reserve(sensor.size());
+    for (const auto& i : sensor) current_motors.push_back(i);
+  }
+  __attribute__((noinline)) bool current_motors_over() const {
+    for (const auto& i : current_motors)
+      if (i.is_over_current()) return true;
+    return false;
+  }
+};
+
+__attribute__((noinline)) static bool new_group(const motor_group& sensor) {
+  for (int i = 0; i < sensor.size(); i++)
+    if (sensor.is_over_current(i)) return true;
+  return false;
+}
+
+int main() {
+  const int CALLS = 1000000;
+  motor left(1), right(11);
+  motor_group group{{1, 2, 3, 4}};
+  pid bound;
+  bound.exit_condition_motors_set({left, right});
+
+  printf("PID mA exit check, %i calls\n", CALLS);
+  double before = bench::time_ns(CALLS, [&](int) { bench::sink = bench::sink + old_vector({left, right}); });
+  double after = bench::time_ns(CALLS, [&](int) { bench::sink = bench::sink + bound.current_motors_over(); });
+  bench::report("2 motors, vector vs bound", before, after);
+
+  before = bench::time_ns(CALLS, [&](int) { bench::sink = bench::sink + old_group(group); });
+  after = bench::time_ns(CALLS, [&](int) { bench::sink = bench::sink + new_group(group); });
+  bench::report("motor group of 4", before, after);
+
+  // Both have to agree on which motors are over current
+  bool pass = true;
+  for (int port : {1, 3, 11}) {
+    motor::over_current[port] = true;
+    pass = pass && old_vector({left, right}) == bound.current_motors_over() && old_group(group) == new_group(group);
+    motor::over_current[port] = false;
+  }
+  printf(pass ? "  pass\n" : "  FAIL, the bound check disagrees with the old one\n");
+  return pass ? 0 : 1;
+}
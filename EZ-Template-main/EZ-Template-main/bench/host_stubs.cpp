@@ -0,0 +1,15 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+// The PROS kernel isn't on the host, these stand in for the calls the headers make while starting up
+
+#include "pros/misc.hpp"
+
+namespace pros {
+namespace usd {
+std::int32_t is_installed(void) { return 0; }
+}  // namespace usd
+}  // namespace pros
@@ -0,0 +1,127 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+// Odometry cost per tick, the old solve_xy_vert / solve_xy_horiz path against util::odom_solve_xy().
+// Both run over the same ticks, and every tick and the final poses have to agree within float tolerance.
+
+#include <cmath>
+#include <vector>
+
+#include "EZ-Template/util.hpp"
+#include "bench.hpp"
+
+using namespace ez;
+
+// solve_xy_vert() and solve_xy_horiz() as they were before odom_solve_xy()
+static pose old_solve_xy_vert(float p_track_width, float current_t, float delta_vert, float delta_t) {
+  pose output = {0.0, 0.0, 0.0};
+  float local_x = delta_vert;
+  float half_delta_t = 0.0;
+  if (delta_t != 0) {
+    half_delta_t = delta_t / 2.0;
+    float i = sin(half_delta_t) * 2.0;
+    local_x = (delta_vert / delta_t - p_track_width) * i;
+  }
+  float alpha = current_t - half_delta_t;
+  float x = cos(alpha) * local_x;
+  float y = sin(alpha) * local_x;
+  output.x = -y;
+  output.y = x;
+  return output;
+}
+
+static pose old_solve_xy_horiz(float p_track_width, float current_t, float delta_horiz, float delta_t) {
+  pose output = {0.0, 0.0, 0.0};
+  float local_y = delta_horiz;
+  float half_delta_t = 0.0;
+  if (delta_t != 0) {
+    half_delta_t = delta_t / 2.0;
+    float i = sin(half_delta_t) * 2.0;
+    local_y = (delta_horiz / delta_t + p_track_width) * i;
+  }
+  float alpha = current_t - half_delta_t;
+  float x = -sin(alpha) * local_y;
+  float y = cos(alpha) * local_y;
+  output.x = -y;
+  output.y = x;
+  return output;
+}
+
+struct tick {
+  float current_t, delta_t, h, l, r;
+};
+
+// Robot geometry, left and right trackers and a back tracker
+const float L_WIDTH = -5.75f, R_WIDTH = 5.75f, H_WIDTH = 3.25f;
+
+// The old ez_tracking_task body, left, right and central
+static void old_tick(const tick& t, float* x, float* y) {
+  pose h_ = old_solve_xy_horiz(H_WIDTH, t.current_t, t.h, t.delta_t);
+  pose l_ = old_solve_xy_vert(L_WIDTH, t.current_t, t.l, t.delta_t);
+  pose r_ = old_solve_xy_vert(R_WIDTH, t.current_t, t.r, t.delta_t);
+  double avg = t.l + t.r;
+  if (avg != 0.0) avg /= 2.0;
+  pose c_ = old_solve_xy_vert(0.0, t.current_t, avg, t.delta_t);
+  x[0] = l_.x + h_.x, y[0] = l_.y + h_.y;
+  x[1] = r_.x + h_.x, y[1] = r_.y + h_.y;
+  x[2] = c_.x + h_.x, y[2] = c_.y + h_.y;
+}
+
+static void new_tick(const tick& t, float* x, float* y) {
+  float deltas[util::ODOM_HYPOTHESES] = {t.l, t.r, (t.l + t.r) / 2.0f};
+  float widths[util::ODOM_HYPOTHESES] = {L_WIDTH, R_WIDTH, 0.0f};
+  util::odom_solve_xy(t.current_t, t.delta_t, t.h, H_WIDTH, deltas, widths, x, y);
+}
+
+int main() {
+  // A few minutes of driving, with some ticks going perfectly straight
+  const int TICKS = 20000;
+  bench::random random;
+  std::vector<tick> ticks(TICKS);
+  float heading = 0.0f;
+  for (int i = 0; i < TICKS; i++) {
+    float delta_t = i % 8 == 0 ? 0.0f : random.next(-0.08, 0.08);
+    heading += delta_t;
+    float forward = random.next(-0.8, 0.8);
+    ticks[i] = {heading, delta_t, (float)random.next(-0.1, 0.1), forward + (L_WIDTH * delta_t), forward + (R_WIDTH * delta_t)};
+  }
+
+  // Every tick has to match, and so does where the robot ends up
+  double worst_tick = 0.0;
+  double old_pose[3][2] = {}, new_pose[3][2] = {};
+  for (auto& t : ticks) {
+    float old_x[3], old_y[3], new_x[3], new_y[3];
+    old_tick(t, old_x, old_y);
+    new_tick(t, new_x, new_y);
+    for (int j = 0; j < 3; j++) {
+      worst_tick = fmax(worst_tick, fmax(fabs(old_x[j] - new_x[j]), fabs(old_y[j] - new_y[j])));
+      old_pose[j][0] += old_x[j], old_pose[j][1] += old_y[j];
+      new_pose[j][0] += new_x[j], new_pose[j][1] += new_y[j];
+    }
+  }
+  double worst_pose = 0.0;
+  for (int j = 0; j < 3; j++)
+    worst_pose = fmax(worst_pose, fmax(fabs(old_pose[j][0] - new_pose[j][0]), fabs(old_pose[j][1] - new_pose[j][1])));
+
+  printf("odometry, %i ticks\n", TICKS);
+  printf("  worst tick difference %.3g in, worst final pose difference %.3g in\n", worst_tick, worst_pose);
+  bool pass = worst_tick < 1e-5 && worst_pose < 1e-3;
+
+  double before = bench::time_ns(TICKS, [&](int i) {
+    float x[3], y[3];
+    old_tick(ticks[i], x, y);
+    bench::sink = bench::sink + x[2] + y[2];
+  });
+  double after = bench::time_ns(TICKS, [&](int i) {
+    float x[3], y[3];
+    new_tick(ticks[i], x, y);
+    bench::sink = bench::sink + x[2] + y[2];
+  });
+  bench::report("per tick", before, after);
+
+  printf(pass ? "  pass\n" : "  FAIL, the new kernel doesn't match the old one\n");
+  return pass ? 0 : 1;
+}
@@ -6,11 +6,17 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include "EZ-Template/pid_policy.hpp"
 #include "EZ-Template/util.hpp"
 #include "api.h"
 
 namespace ez {
-class PID {
+/**
+ * Runtime configured PID.  This is ez::pid::core with derivative filtering, anti-windup, setpoint weighting, gain
+ * schedules and mA / secondary sensor exits on top.  Use ez::pid::core directly when the features can be chosen at
+ * compile time.
+ */
+class PID : public pid::core<pid::derivative_filtered, pid::integral_back_calculation, pid::output_unclamped, pid::exit_timers> {
  public:
   /**
    * Default constructor.
@@ -34,39 +40,21 @@ class PID {
   PID(double p, double i = 0, double d = 0, double start_i = 0, std::string name = "");
 
   /**
-   * Set constants for PID.
-   *
-   * \param p
-   *        kP
-   * \param i
-   *        ki
-   * \param d
-   *        kD
-   * \param p_start_i
-   *        error value that i starts within
+   * Struct for constants.
    */
-  void constants_set(double p, double i = 0, double d = 0, double p_start_i = 0);
+  using Constants = pid::constants;
 
   /**
-   * Struct for constants.
+   * Struct for exit condition.
    */
-  struct Constants {
-    double kp;
-    double ki;
-    double kd;
-    double start_i;
-  };
+  using exit_condition_ = pid::exit_constants;
 
   /**
-   * Struct for exit condition.
+   * Struct for a gain schedule entry.  Constants are used as-is at key, and linearly blended between keys.
    */
-  struct exit_condition_ {
-    int small_exit_time = 0;
-    double small_error = 0;
-    int big_exit_time = 0;
-    double big_error = 0;
-    int velocity_exit_time = 0;
-    int mA_timeout = 0;
+  struct gain_point {
+    double key;
+    Constants constants;
   };
 
   /**
@@ -133,16 +121,6 @@ class PID {
    */
   void variables_reset();
 
-  /**
-   * Constants.
-   */
-  Constants constants;
-
-  /**
-   * Exit.
-   */
-  exit_condition_ exit;
-
   /**
    * Updates a secondary sensor for velocity exiting.  Ideal use is IMU during normal drive motions.
    *
@@ -196,13 +174,47 @@ class PID {
   double velocity_sensor_secondary_exit_get();
 
   /**
-   * Iterative exit condition for PID.
+   * Iterative exit condition for PID.  Checks the motors bound with exit_condition_motors_set() for the mA exit.
    *
    * \param print = false
    *        if true, prints when complete
    */
   ez::exit_output exit_condition(bool print = false);
 
+  /**
+   * Binds the motors used for the mA exit.  After this, exit_condition() checks them without copying anything.
+   *
+   * \param sensor
+   *        a pros motor on your mechanism
+   */
+  void exit_condition_motors_set(pros::Motor sensor);
+
+  /**
+   * Binds the motors used for the mA exit.  After this, exit_condition() checks them without copying anything.
+   *
+   * \param sensor
+   *        pros motors on your mechanism
+   */
+  void exit_condition_motors_set(const std::vector<pros::Motor>& sensor);
+
+  /**
+   * Binds the motors used for the mA exit.  After this, exit_condition() checks them without copying anything.
+   *
+   * \param sensor
+   *        pros motor group on your mechanism
+   */
+  void exit_condition_motors_set(const pros::MotorGroup& sensor);
+
+  /**
+   * Unbinds the motors used for the mA exit.
+   */
+  void exit_condition_motors_clear();
+
+  /**
+   * Returns the motors used for the mA exit.
+   */
+  const std::vector<pros::Motor>& exit_condition_motors_get();
+
   /**
    * Iterative exit condition for PID.
    *
@@ -213,6 +225,16 @@ class PID {
    */
   ez::exit_output exit_condition(pros::Motor sensor, bool print = false);
 
+  /**
+   * Iterative exit condition for PID, using a current check that has already been read this tick.
+   *
+   * \param over_current
+   *        true when the motors on your mechanism are pulling too many mA
+   * \param print = false
+   *        if true, prints when complete
+   */
+  ez::exit_output exit_condition_mA(bool over_current, bool print = false);
+
   /**
    * Iterative exit condition for PID.
    *
@@ -221,7 +243,7 @@ class PID {
    * \param print = false
    *        if true, prints when complete
    */
-  ez::exit_output exit_condition(std::vector<pros::Motor> sensor, bool print = false);
+  ez::exit_output exit_condition(const std::vector<pros::Motor>& sensor, bool print = false);
 
   /**
    * Iterative exit condition for PID.
@@ -231,7 +253,7 @@ class PID {
    * \param print = false
    *        if true, prints when complete
    */
-  ez::exit_output exit_condition(pros::MotorGroup sensor, bool print = false);
+  ez::exit_output exit_condition(const pros::MotorGroup& sensor, bool print = false);
 
   /**
    * Sets the name of the PID that prints during exit conditions.
@@ -263,37 +285,133 @@ class PID {
    */
   bool i_reset_get();
 
+  /**
+   * Sets how much the derivative is smoothed.  This helps with noisy sensors so kD can be raised without chatter.
+   *
+   * \param filter
+   *        0 to 1, 0 is no filtering and higher values smooth more but react slower
+   */
+  void derivative_filter_set(double filter);
+
+  /**
+   * Returns how much the derivative is smoothed, 0 to 1.
+   */
+  double derivative_filter_get();
+
+  /**
+   * Sets the back calculation anti-windup gain.  When the output gets clamped, i is pulled back so it
+   * doesn't keep growing while the mechanism is already going as fast as it's allowed to.
+   *
+   * This needs output_saturated_set() to be called with what was actually sent to the motors.
+   *
+   * \param gain
+   *        0 disables, 1 removes all of the clamped output from i every iteration
+   */
+  void anti_windup_set(double gain);
+
+  /**
+   * Returns the back calculation anti-windup gain.
+   */
+  double anti_windup_get();
+
+  /**
+   * Tells the PID what output was actually used after slew and max speed clamped it.  This is used for anti-windup.
+   *
+   * \param saturated
+   *        the output after clamping
+   */
+  void output_saturated_set(double saturated);
+
+  /**
+   * Sets setpoint weighting for kP.  kP will act on weight * target - current, with target and current relative
+   * to where the motion started.  Lower weights soften the initial jump in output so higher gains can be used.
+   *
+   * Weights below 1 leave P short of target, so use this with kI.  Only compute() uses this, compute_error() doesn't.
+   *
+   * \param weight
+   *        0 to 1, 1 disables
+   */
+  void setpoint_weight_set(double weight);
+
+  /**
+   * Returns the setpoint weight for kP.
+   */
+  double setpoint_weight_get();
+
+  /**
+   * Sets a gain schedule.  While a schedule is set, compute() uses constants interpolated from this table by
+   * gain_schedule_iterate() instead of the ones set with constants_set(), which constants_get() still returns.
+   *
+   * ie, pid.gain_schedule_set(ez::TARGET_SCHEDULE, {{15, {4, 0, 20, 0}}, {90, {3, 0.05, 20, 15}}, {180, {2.5, 0.05, 25, 15}}});
+   *
+   * \param key
+   *        ez::TARGET_SCHEDULE keys on how far the motion is, ez::SPEED_SCHEDULE keys on sensor units per second
+   * \param table
+   *        entries to interpolate between, these don't need to be in order.  An empty table disables the schedule
+   */
+  void gain_schedule_set(e_gain_schedule key, std::vector<gain_point> table);
+
+  /**
+   * Removes the gain schedule, compute() goes back to the constants set with constants_set().
+   */
+  void gain_schedule_clear();
+
+  /**
+   * Returns true if a gain schedule is set.
+   */
+  bool gain_schedule_enabled();
+
+  /**
+   * Returns the constants interpolated from the gain schedule at key.  Keys outside the table use the closest entry.
+   *
+   * \param key
+   *        value to look up
+   */
+  Constants gain_schedule_get(double key);
+
+  /**
+   * Updates the interpolated constants from the gain schedule.  Call this before compute(), this does nothing without
+   * a schedule.
+   *
+   * \param current
+   *        current sensor value
+   */
+  void gain_schedule_iterate(double current);
+
   /**
    * Resets all timers for exit conditions.
    */
   void timers_reset();
 
   /**
-   * PID variables.
+   * PID variables, the rest are in ez::pid::core.
    */
-  double output = 0.0;
   double cur = 0.0;
-  double error = 0.0;
-  double target = 0.0;
-  double prev_error = 0.0;
-  double prev_current = 0.0;
-  double integral = 0.0;
-  double derivative = 0.0;
   long time = 0;
   long prev_time = 0;
 
  private:
-  double velocity_zero_main = 0.05;
   double velocity_zero_secondary = 0.075;
-  int i = 0, j = 0, k = 0, l = 0, m = 0;
+  int mA_timer = 0, secondary_timer = 0;
   bool is_mA = false;
   double second_sensor = 0.0;
+  std::vector<pros::Motor> current_motors;
+  bool current_motors_over();
+  ez::exit_output exit_condition_iterate(bool print);
 
   std::string name;
   bool name_active = false;
   void exit_condition_print(ez::exit_output exit_type);
   bool reset_i_sgn = true;
   double raw_compute();
+  double p_error = 0.0;
+  double setpoint_weight = 1.0;
+  double setpoint_start = 0.0;
+  bool new_target = true;
+  std::vector<gain_point> schedule;
+  e_gain_schedule schedule_key = TARGET_SCHEDULE;
+  Constants schedule_constants = {0, 0, 0, 0};  // Interpolated from the schedule, constants is left as the user set it
+  const Constants& constants_active();
   bool use_second_sensor = false;
 };
 };  // namespace ez
\ No newline at end of file
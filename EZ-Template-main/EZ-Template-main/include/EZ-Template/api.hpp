@@ -9,7 +9,12 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "EZ-Template/PID.hpp"
 #include "EZ-Template/auton.hpp"
 #include "EZ-Template/auton_selector.hpp"
+#include "EZ-Template/controller_display.hpp"
+#include "EZ-Template/controller_input.hpp"
+#include "EZ-Template/coroutine.hpp"
 #include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/drive/motion_handle.hpp"
+#include "EZ-Template/pid_policy.hpp"
 #include "EZ-Template/piston.hpp"
 #include "EZ-Template/sdcard.hpp"
 #include "EZ-Template/slew.hpp"
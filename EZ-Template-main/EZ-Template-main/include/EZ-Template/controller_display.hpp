@@ -0,0 +1,79 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "api.h"
+
+namespace ez {
+class ControllerDisplay {
+ public:
+  /**
+   * Controller display constructor.
+   *
+   * Text and rumble are written here right away and sent to the controller from a background task, one update at a
+   * time, only when something changed.  The controller drops updates sent faster than every 50ms.
+   *
+   * \param input_controller
+   *        controller to write to
+   * \param interval
+   *        ms between updates sent to the controller
+   */
+  ControllerDisplay(pros::Controller* input_controller, int interval = 50);
+
+  /**
+   * Sets the text on a line.  Text is padded to the width of the controller so old text gets cleared.
+   *
+   * \param line
+   *        0 to 2
+   * \param text
+   *        text to show, up to 15 characters
+   */
+  void set_text(int line, std::string text);
+
+  /**
+   * Clears a line.
+   *
+   * \param line
+   *        0 to 2
+   */
+  void clear_line(int line);
+
+  /**
+   * Returns the text that will be shown on a line.
+   *
+   * \param line
+   *        0 to 2
+   */
+  std::string text_get(int line);
+
+  /**
+   * Rumbles the controller.  This gets sent before any text that's waiting.
+   *
+   * \param pattern
+   *        '.' short, '-' long, ' ' pause, up to 8 characters
+   */
+  void rumble(std::string pattern);
+
+ private:
+  pros::Controller* controller;
+  int update_interval;
+  pros::Mutex mutex;
+  std::string desired[3];
+  std::string sent[3];
+  std::string rumble_pattern;
+  bool was_connected = false;
+  pros::Task task;
+  void task_loop();
+};
+
+/**
+ * Display for the master controller.
+ */
+extern ControllerDisplay master_display;
+}  // namespace ez
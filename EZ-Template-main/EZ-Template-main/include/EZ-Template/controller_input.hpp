@@ -0,0 +1,83 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "api.h"
+
+namespace ez {
+class ControllerInput {
+ public:
+  /**
+   * Controller input constructor.
+   *
+   * Every axis and button is read once per update(), and everything that reads the controller uses that snapshot.
+   * This means new presses and releases are the same for every part of the code during one loop.
+   *
+   * \param input_controller
+   *        controller to read from
+   */
+  ControllerInput(pros::Controller* input_controller);
+
+  /**
+   * Reads every axis and button from the controller.  Run this once at the start of the opcontrol loop.
+   *
+   * If this hasn't run in 2 ticks, every read goes straight to the controller instead, so code that never calls this
+   * sees each new press once per button like pros::Controller::get_digital_new_press().
+   */
+  void update();
+
+  /**
+   * Returns an axis from the last snapshot, -127 to 127.
+   *
+   * \param channel
+   *        pros::E_CONTROLLER_ANALOG_LEFT_X, LEFT_Y, RIGHT_X or RIGHT_Y
+   */
+  int analog(pros::controller_analog_e_t channel);
+
+  /**
+   * Returns true if the button was held in the last snapshot.
+   *
+   * \param button
+   *        a pros controller button
+   */
+  bool digital(pros::controller_digital_e_t button);
+
+  /**
+   * Returns true if the button was pressed between the last two snapshots.
+   *
+   * \param button
+   *        a pros controller button
+   */
+  bool digital_new_press(pros::controller_digital_e_t button);
+
+  /**
+   * Returns true if the button was released between the last two snapshots.
+   *
+   * \param button
+   *        a pros controller button
+   */
+  bool digital_new_release(pros::controller_digital_e_t button);
+
+ private:
+  pros::Controller* controller;
+  int axes[4] = {0, 0, 0, 0};
+  bool buttons[12] = {false};
+  bool last_buttons[12] = {false};
+  bool release_last[12] = {false};  // Only used while update() isn't being called
+  std::uint32_t last_update = 0;
+  bool updated = false;
+  bool snapshot_active();
+  int button_index(pros::controller_digital_e_t button);
+};
+
+/**
+ * Input snapshot for the master controller.
+ */
+extern ControllerInput master_input;
+}  // namespace ez
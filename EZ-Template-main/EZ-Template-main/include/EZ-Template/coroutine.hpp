@@ -0,0 +1,150 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <coroutine>
+#include <functional>
+#include <vector>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/drive/motion_handle.hpp"
+#include "EZ-Template/util.hpp"
+#include "okapi/api/units/QTime.hpp"
+
+namespace ez {
+namespace co {
+/**
+ * A coroutine that can be multiplexed with other routines on one task by ez::co::run().
+ *
+ * Any function returning an ez::co::routine can co_await motions, delays, conditions, and other routines.
+ */
+class routine {
+ public:
+  struct promise_type {
+    std::function<bool()> ready;  // What the routine is waiting on, empty means run on the next tick
+
+    routine get_return_object() { return routine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  routine(routine&& other) noexcept;
+  routine& operator=(routine&& other) noexcept;
+  routine(const routine&) = delete;
+  routine& operator=(const routine&) = delete;
+  ~routine();
+
+  /**
+   * Returns true once the routine has returned.
+   */
+  bool done();
+
+  /**
+   * Runs the routine until its next co_await if what it's waiting on is ready.
+   *
+   * This is called for you by ez::co::run().
+   */
+  void resume_if_ready();
+
+  /**
+   * Lets a routine co_await another routine.  The inner routine runs on the same task as the outer one.
+   */
+  bool await_ready() { return done(); }
+  void await_suspend(std::coroutine_handle<promise_type> caller);
+  void await_resume() {}
+
+ private:
+  explicit routine(std::coroutine_handle<promise_type> handle);
+  std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * Awaitable that resumes the routine once condition returns true.  The condition is checked once per tick.
+ */
+struct until_awaiter {
+  std::function<bool()> condition;
+
+  bool await_ready() { return condition(); }
+  void await_suspend(std::coroutine_handle<routine::promise_type> caller) { caller.promise().ready = condition; }
+  void await_resume() {}
+};
+
+/**
+ * Awaitable that resumes the routine once a motion has exited.  co_await returns the exit reason.
+ */
+struct motion_awaiter {
+  motion_handle motion;
+
+  bool await_ready() { return motion.done(); }
+  void await_suspend(std::coroutine_handle<routine::promise_type> caller);
+  exit_output await_resume() { return motion.exit_reason_get(); }
+};
+
+/**
+ * Suspends the routine until condition returns true.
+ *
+ * \param condition
+ *        function that returns true when the routine should continue
+ */
+until_awaiter until(std::function<bool()> condition);
+
+/**
+ * Suspends the routine for some time without blocking the other routines.
+ *
+ * \param time
+ *        time in ms
+ */
+until_awaiter delay(int time);
+
+/**
+ * Suspends the routine for some time without blocking the other routines, with okapi units.
+ *
+ * \param p_time
+ *        time, okapi unit
+ */
+until_awaiter delay(okapi::QTime p_time);
+
+/**
+ * Suspends the routine until the next tick.
+ */
+until_awaiter next_tick();
+
+/**
+ * Runs every routine on the calling task until they have all returned.
+ *
+ * The task sleeps between ticks and is woken by the drive's control loop, so routines resume in step with the PID.
+ *
+ * \param drive
+ *        the drive whose control loop paces the routines
+ * \param routines
+ *        routines to run
+ */
+void run(Drive& drive, std::vector<routine>& routines);
+
+/**
+ * Runs every routine on the calling task until they have all returned.
+ *
+ * \param drive
+ *        the drive whose control loop paces the routines
+ * \param routines
+ *        routines to run, ie ez::co::run(chassis, drive_part(), intake_part());
+ */
+template <typename... Routines>
+void run(Drive& drive, Routines&&... routines) {
+  std::vector<routine> list;
+  (list.push_back(std::move(routines)), ...);
+  run(drive, list);
+}
+}  // namespace co
+
+/**
+ * Lets routines co_await a motion directly, ie co_await chassis.pid_drive_set(24_in, 110);
+ */
+inline co::motion_awaiter operator co_await(motion_handle motion) { return {motion}; }
+};  // namespace ez
@@ -6,16 +6,20 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <iostream>
+#include <optional>
 #include <tuple>
 
 #include "EZ-Template/PID.hpp"
+#include "EZ-Template/drive/motion_handle.hpp"
 #include "EZ-Template/slew.hpp"
 #include "EZ-Template/tracking_wheel.hpp"
 #include "EZ-Template/util.hpp"
 #include "okapi/api/units/QAngle.hpp"
 #include "okapi/api/units/QLength.hpp"
+#include "okapi/api/units/QSpeed.hpp"
 #include "okapi/api/units/QTime.hpp"
 #include "pros/motor_group.hpp"
 #include "pros/motors.h"
@@ -58,9 +62,9 @@ class Drive {
   std::vector<pros::Motor> right_motors;
 
   /**
-   * Vector of pros motors that are disconnected from the drive.
+   * Bitmask of smart ports that are disconnected from the drive, bit 0 is port 1.  This only changes between ticks.
    */
-  std::vector<int> pto_active;
+  std::atomic<std::uint32_t> pto_active = 0;
 
   /**
    * Inertial sensor.
@@ -129,6 +133,8 @@ class Drive {
   PID internal_rightPID;
   PID left_activebrakePID;
   PID right_activebrakePID;
+  PID left_velocityPID;
+  PID right_velocityPID;
 
   /**
    * Slew objects.
@@ -377,10 +383,23 @@ class Drive {
   e_mode drive_mode_get();
 
   /**
-   * Calibrates imu and initializes sd card to curve.
+   * Calibrates imu and loads everything saved on the sd card.
+   *
+   * This returns right away and does the work in a background task.  The drive ignores outputs until it's done, use
+   * drive_initialized() or drive_initialize_wait() to know when the robot is ready.
    */
   void initialize();
 
+  /**
+   * Returns true once initialize() has finished in the background.
+   */
+  bool drive_initialized();
+
+  /**
+   * Blocks until initialize() has finished in the background.  Returns true if the imu calibrated.
+   */
+  bool drive_initialize_wait();
+
   /**
    * Tasks for autonomous.
    */
@@ -858,6 +877,35 @@ class Drive {
    */
   void odom_tracker_back_set(tracking_wheel* input);
 
+  /**
+   * Finds tracking wheel diameters, tracking wheel distances to center and the drive's track width, then saves them
+   * to the SD card.  This blocks until it's done, so run it as an autonomous.
+   *
+   * With a front distance sensor, the robot drives forward and back to find the diameter of the left and right
+   * trackers, so start facing a wall more than distance away.  Without one, diameters are skipped and left as they're
+   * set in code, since the drive motors slip and only know the wheel diameter they were told.  Then the robot spins
+   * both directions and tracker offsets and track width are found against the IMU, so calibrate the IMU scaler first.
+   *
+   * The back and front trackers never move during these drives, so only their offsets are calibrated.  Measure their
+   * diameters by hand.
+   *
+   * The results are loaded from the SD card in initialize(), delete odom_calibration.txt to go back to what's set
+   * in code.
+   *
+   * \param samples
+   *        how many times to drive and spin in each direction
+   * \param distance
+   *        how far to drive forward and back, in inches
+   * \param speed
+   *        0 to 127, max speed while driving and spinning
+   */
+  void drive_odom_calibrate(int samples = 4, double distance = 24.0, int speed = 60);
+
+  /**
+   * Loads the geometry saved by drive_odom_calibrate() from the SD card.  This runs in initialize().
+   */
+  void drive_odom_calibration_sd_initialize();
+
   /**
    * Sets the default behavior for turns in odom, swinging, and turning.
    *
@@ -978,6 +1026,15 @@ class Drive {
    */
   void opcontrol_arcade_flipped(e_type stick_type);
 
+  /**
+   * Sets the chassis to controller joysticks for a holonomic drive.  Left stick is fwd/rev and strafe, right stick x is turning.
+   * Run in usercontrol.
+   *
+   * This passes the controller through the curve functions, but is disabled by default.
+   * Use opcontrol_curve_buttons_toggle() to enable it.
+   */
+  void opcontrol_holonomic();
+
   /**
    * Initializes left and right curves with the SD card, recommended to run in initialize().
    */
@@ -1087,6 +1144,26 @@ class Drive {
    */
   double opcontrol_curve_right(double x);
 
+  /**
+   * Replaces the left joystick curve with your own, like a piecewise or cubic curve.  The curve is run once for every
+   * joystick value when it's set and when the curve scale changes, so it doesn't slow down driving.
+   *
+   * \param curve
+   *        function taking the joystick value from -127 to 127 and the left curve scale, and returning the output.
+   *        nullptr goes back to the 5225A curve
+   */
+  void opcontrol_curve_left_set(std::function<double(double, double)> curve);
+
+  /**
+   * Replaces the right joystick curve with your own, like a piecewise or cubic curve.  The curve is run once for every
+   * joystick value when it's set and when the curve scale changes, so it doesn't slow down driving.
+   *
+   * \param curve
+   *        function taking the joystick value from -127 to 127 and the right curve scale, and returning the output.
+   *        nullptr goes back to the 5225A curve
+   */
+  void opcontrol_curve_right_set(std::function<double(double, double)> curve);
+
   /**
    * Sets a new threshold for the joystick.
    *
@@ -1131,12 +1208,14 @@ class Drive {
    * \param check_if_pto
    *        motor to check
    */
-  bool pto_check(pros::Motor check_if_pto);
+  bool pto_check(const pros::Motor& check_if_pto);
 
   /**
    * Adds motors to the pto list, removing them from the drive.
    *
-   * You cannot add the first index because it's used for autonomous.
+   * Any drive motor can be added, but at least one motor per side has to stay on the drive for its sensors.
+   *
+   * The motors are handed over at the start of the next tick, or after pto_transition_set() time if it's set.
    *
    * \param pto_list
    *        list of motors to remove from the drive
@@ -1154,7 +1233,7 @@ class Drive {
   /**
    * Adds/removes motors from drive.
    *
-   * You cannot add the first index because it's used for autonomous.
+   * Any drive motor can be added, but at least one motor per side has to stay on the drive for its sensors.
    *
    * \param pto_list
    *        list of motors to add/remove from the drive
@@ -1163,6 +1242,32 @@ class Drive {
    */
   void pto_toggle(std::vector<pros::Motor> pto_list, bool toggle);
 
+  /**
+   * Sets how long motors leaving the drive get ramped down for before they're handed over to the mechanism.
+   *
+   * \param time
+   *        time in ms, 0 hands them over on the next tick
+   */
+  void pto_transition_set(int time);
+
+  /**
+   * Sets how long motors leaving the drive get ramped down for before they're handed over to the mechanism.
+   *
+   * \param p_time
+   *        okapi time unit
+   */
+  void pto_transition_set(okapi::QTime p_time);
+
+  /**
+   * Returns how long motors leaving the drive get ramped down for in ms.
+   */
+  int pto_transition_get();
+
+  /**
+   * Returns true while pto changes are waiting to be handed over.
+   */
+  bool pto_transitioning();
+
   /////
   //
   // PROS Wrappers
@@ -1181,6 +1286,36 @@ class Drive {
    */
   void drive_set(int left, int right);
 
+  /**
+   * Sets a holonomic chassis to voltage.
+   *
+   * Disables PID when called.
+   *
+   * \param forward
+   *        forward and backward, -127 to 127
+   * \param strafe
+   *        right and left, -127 to 127
+   * \param turn
+   *        clockwise and counter clockwise, -127 to 127
+   */
+  void drive_holonomic_output_set(int forward, int strafe, int turn);
+
+  /**
+   * Enables holonomic (X-drive and mecanum) kinematics.
+   *
+   * The first half of each side's motors are the front wheels and the second half are the back wheels.
+   * Odom motions translate and turn at the same time instead of facing the point they're driving to.
+   *
+   * \param toggle
+   *        true enables, false disables
+   */
+  void drive_holonomic_set(bool toggle);
+
+  /**
+   * Returns true if holonomic kinematics are enabled.
+   */
+  bool drive_holonomic_get();
+
   /**
    * Gets the chassis to voltage, -127 to 127.  Returns {left, right}.
    */
@@ -1212,6 +1347,98 @@ class Drive {
    */
   int drive_current_limit_get();
 
+  /**
+   * Struct for what the current budget decided for a motor.
+   */
+  struct budget_motor {
+    int port;                        // negative when reversed, same as pros::Motor::get_port()
+    int priority;
+    bool drive;                      // true for drive motors, false for mechanisms and pto'd motors
+    double temperature = 0.0;        // degrees C
+    double heating = 0.0;            // degrees C per second
+    double step_time = 0.0;          // seconds since the reported temperature last changed
+    double step_size = 0.0;          // degrees C the reported temperature last changed by
+    double time_to_throttle = 1e9;   // seconds until the motor starts throttling
+    int limit = 2500;                // current limit given to the motor, mA
+    int limit_before = -1;           // limit the motor had before the budget first changed it, mA, -1 when untouched
+  };
+
+  /**
+   * Enables the current budget.  Every 100ms the temperature of every drive motor and every motor added with
+   * drive_budget_motors_add() is read, and current limits are split between them by priority.  Motors that are
+   * heating up fast get less so they last the whole match, and current a motor can't use goes to the rest.
+   *
+   * \param toggle
+   *        true enables, false disables and gives every motor back its normal limit
+   */
+  void drive_budget_set(bool toggle);
+
+  /**
+   * Returns true if the current budget is enabled.
+   */
+  bool drive_budget_get();
+
+  /**
+   * Sets constants for the current budget.
+   *
+   * \param total_mA
+   *        current shared between all motors in the budget
+   * \param horizon
+   *        seconds the motors need to last without throttling, ie 60 for skills
+   * \param drive_priority
+   *        priority of drive motors, mechanisms with a higher priority get more current
+   * \param pto_priority
+   *        priority of drive motors while they're pto'd to a mechanism
+   */
+  void drive_budget_constants_set(int total_mA, double horizon = 60.0, int drive_priority = 2, int pto_priority = 1);
+
+  /**
+   * Adds mechanism motors to the current budget.
+   *
+   * \param motors
+   *        motors on the mechanism
+   * \param priority
+   *        higher priorities get more current
+   */
+  void drive_budget_motors_add(std::vector<pros::Motor> motors, int priority = 1);
+
+  /**
+   * Returns what the current budget last decided for every motor.
+   */
+  std::vector<budget_motor> drive_budget_report_get();
+
+  /**
+   * Enables battery voltage compensation.  Drive outputs get scaled so the same output gives the same voltage
+   * at the motors no matter how charged the battery is.
+   *
+   * \param toggle
+   *        true enables, false disables
+   */
+  void drive_battery_compensation_set(bool toggle);
+
+  /**
+   * Returns true if battery voltage compensation is enabled.
+   */
+  bool drive_battery_compensation_get();
+
+  /**
+   * Sets the battery voltage that outputs are scaled to.  127 is this many volts, and batteries above it get scaled down.
+   *
+   * \param volts
+   *        nominal battery voltage, defaults to 12
+   */
+  void drive_battery_nominal_set(double volts);
+
+  /**
+   * Returns the battery voltage that outputs are scaled to.
+   */
+  double drive_battery_nominal_get();
+
+  /**
+   * Returns the filtered battery voltage in volts.
+   */
+  double drive_battery_get();
+
   /**
    * Toggles set drive in autonomous.
    *
@@ -1262,25 +1489,40 @@ class Drive {
   /**
    * The position of the right sensor.
    *
-   * If you have two parallel tracking wheels, this will return tracking wheel position.  Otherwise this returns motor position.
+   * If you have two parallel tracking wheels, this will return tracking wheel position.  Otherwise this returns motor position,
+   * fused from every right motor that is plugged in and agrees with the others.
    */
   int drive_sensor_right_raw();
 
   /**
-   * The velocity of the right motor.
+   * The velocity of the right motor.  This uses the first right motor that hasn't failed.
    */
   int drive_velocity_right();
 
   /**
-   * The watts of the right motor.
+   * The watts of the right motor.  This uses the first right motor that hasn't failed.
    */
   double drive_mA_right();
 
   /**
-   * Return true when the motor is over current.
+   * Return true when any right motor that hasn't failed is over current.
    */
   bool drive_current_right_over();
 
+  /**
+   * Returns the ports of drive motors that are unplugged or disagree with the rest of their side.
+   *
+   * These motors are left out of the drive sensors until they agree with the rest again.
+   */
+  std::vector<int> drive_motors_failed_get();
+
+  /**
+   * How far a holonomic drive has strafed in inches, measured from the drive motors.  Right is positive.
+   *
+   * This is only computed with integrated encoders, a horizontal tracking wheel should be used otherwise.
+   */
+  double drive_sensor_strafe();
+
   /**
    * The position of the left sensor in inches.
    *
@@ -1291,22 +1533,23 @@ class Drive {
   /**
    * The position of the left sensor.
    *
-   * If you have two parallel tracking wheels, this will return tracking wheel position.  Otherwise this returns motor position.
+   * If you have two parallel tracking wheels, this will return tracking wheel position.  Otherwise this returns motor position,
+   * fused from every left motor that is plugged in and agrees with the others.
    */
   int drive_sensor_left_raw();
 
   /**
-   * The velocity of the left motor.
+   * The velocity of the left motor.  This uses the first left motor that hasn't failed.
    */
   int drive_velocity_left();
 
   /**
-   * The watts of the left motor.
+   * The watts of the left motor.  This uses the first left motor that hasn't failed.
    */
   double drive_mA_left();
 
   /**
-   * Return true when the motor is over current.
+   * Return true when any left motor that hasn't failed is over current.
    */
   bool drive_current_left_over();
 
@@ -1333,6 +1576,63 @@ class Drive {
    */
   double drive_imu_accel_get();
 
+  /**
+   * Adds a second IMU.  Heading becomes a weighted average of both IMUs, with each one's drift and noise learned
+   * while the robot is still, and the second IMU's scale matched to the first while turning.
+   *
+   * If one IMU unplugs or glitches, the other one is used until it comes back.
+   *
+   * \param port
+   *        port the second IMU is plugged into
+   */
+  void drive_imu_secondary_set(int port);
+
+  /**
+   * Returns the learned drift of each IMU in degrees per second, {primary, secondary}.
+   */
+  std::vector<double> drive_imu_drift_get();
+
+  /**
+   * Enables wheel slip detection and traction control.  This only works with integrated encoders.
+   *
+   * Over the last 100ms, how far the IMEs say each side moved is compared to tracking wheels when there are vertical
+   * trackers, or to the IMU when there aren't.  While a side is slipping its output gets limited until it grips again.
+   *
+   * \param toggle
+   *        true enables, false disables
+   */
+  void drive_slip_detection_set(bool toggle);
+
+  /**
+   * Returns true if wheel slip detection is enabled.
+   */
+  bool drive_slip_detection_get();
+
+  /**
+   * Sets constants for slip detection and traction control.
+   *
+   * \param threshold
+   *        how much faster the IMEs can read than the reference before it counts as slip, in/s.  Without trackers
+   *        this is how much more the IMEs can change speed than the IMU saw, in/s
+   * \param reduction
+   *        0 to 1, the output limit is multiplied by this every tick a side is slipping
+   * \param recovery
+   *        how much the output limit goes back up by every tick a side isn't slipping, 0 to 127
+   * \param minimum
+   *        the output limit never goes below this, 0 to 127
+   */
+  void drive_slip_constants_set(double threshold, double reduction = 0.8, double recovery = 10.0, double minimum = 40.0);
+
+  /**
+   * Returns true if the left side is slipping.
+   */
+  bool drive_slip_left_get();
+
+  /**
+   * Returns true if the right side is slipping.
+   */
+  bool drive_slip_right_get();
+
   /**
    * Sets a new imu scaling factor.
    *
@@ -1348,6 +1648,35 @@ class Drive {
    */
   double drive_imu_scaler_get();
 
+  /**
+   * Finds the imu scaling factor by turning the robot a known number of revolutions, then saves it to the SD card.
+   * This blocks until it's done, so it can be put on a button in opcontrol or run as an autonomous.
+   *
+   * With a left and right tracking wheel the trackers measure how far the robot turned.  Without them, start with the
+   * back of the robot against a wall.  Every revolution the robot drives off the wall, turns, and backs into the wall
+   * again so the wall squares it up to exactly one revolution.
+   *
+   * The scaler is loaded from the SD card in initialize(), delete imu_scaler.txt to go back to drive_imu_scaler_set().
+   *
+   * \param revolutions
+   *        how many revolutions to average, at least 2
+   * \param speed
+   *        0 to 127, max speed while turning
+   * \param wall_distance
+   *        how far to drive off the wall before turning, in inches
+   */
+  double drive_imu_scaler_calibrate(int revolutions = 5, int speed = 60, double wall_distance = 6.0);
+
+  /**
+   * Returns the variance of the imu scaling factor between revolutions from the last drive_imu_scaler_calibrate().
+   */
+  double drive_imu_scaler_variance_get();
+
+  /**
+   * Loads the imu scaling factor saved by drive_imu_scaler_calibrate() from the SD card.  This runs in initialize().
+   */
+  void drive_imu_scaler_sd_initialize();
+
   /**
    * Calibrates the IMU, recommended to run in initialize().
    *
@@ -1414,7 +1743,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_odom_set(double target, int speed);
+  motion_handle pid_odom_set(double target, int speed);
 
   /**
    * Sets the robot to move forward using PID without okapi units, using slew if enabled for this motion.
@@ -1428,7 +1757,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_set(double target, int speed, bool slew_on);
+  motion_handle pid_odom_set(double target, int speed, bool slew_on);
 
   /**
    * Sets the robot to move forward using PID with okapi units, only using slew if globally enabled.
@@ -1440,7 +1769,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_odom_set(okapi::QLength p_target, int speed);
+  motion_handle pid_odom_set(okapi::QLength p_target, int speed);
 
   /**
    * Sets the robot to move forward using PID with okapi units, using slew if enabled for this motion.
@@ -1456,7 +1785,7 @@ class Drive {
    * \param toggle_heading
    *        toggle for heading correction.  true enables, false disables
    */
-  void pid_odom_set(okapi::QLength p_target, int speed, bool slew_on);
+  motion_handle pid_odom_set(okapi::QLength p_target, int speed, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1464,7 +1793,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement
    */
-  void pid_odom_set(odom imovement);
+  motion_handle pid_odom_set(odom imovement);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1474,7 +1803,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_set(odom imovement, bool slew_on);
+  motion_handle pid_odom_set(odom imovement, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1482,7 +1811,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement
    */
-  void pid_odom_ptp_set(odom imovement);
+  motion_handle pid_odom_ptp_set(odom imovement);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1492,7 +1821,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_ptp_set(odom imovement, bool slew_on);
+  motion_handle pid_odom_ptp_set(odom imovement, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point using boomerang.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1500,7 +1829,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement
    */
-  void pid_odom_boomerang_set(odom imovement);
+  motion_handle pid_odom_boomerang_set(odom imovement);
 
   /**
    * Takes in an odom movement to go to a single point using boomerang.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1510,7 +1839,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_boomerang_set(odom imovement, bool slew_on);
+  motion_handle pid_odom_boomerang_set(odom imovement, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point using boomerang.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1518,7 +1847,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement.  values are united here with okapi units
    */
-  void pid_odom_boomerang_set(united_odom p_imovement);
+  motion_handle pid_odom_boomerang_set(united_odom p_imovement);
 
   /**
    * Takes in an odom movement to go to a single point using boomerang.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1528,7 +1857,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_boomerang_set(united_odom p_imovement, bool slew_on);
+  motion_handle pid_odom_boomerang_set(united_odom p_imovement, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1536,7 +1865,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement.  values are united here with okapi units
    */
-  void pid_odom_ptp_set(united_odom p_imovement);
+  motion_handle pid_odom_ptp_set(united_odom p_imovement);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1546,7 +1875,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_ptp_set(united_odom p_imovement, bool slew_on);
+  motion_handle pid_odom_ptp_set(united_odom p_imovement, bool slew_on);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if globally enabled.
@@ -1554,7 +1883,7 @@ class Drive {
    * \param imovement
    *        {{x, y, t}, fwd/rev, 1-127}  an odom movement.  values are united here with okapi units
    */
-  void pid_odom_set(united_odom p_imovement);
+  motion_handle pid_odom_set(united_odom p_imovement);
 
   /**
    * Takes in an odom movement to go to a single point.  If an angle is set, this will run boomerang.  Uses slew if enabled for this motion.
@@ -1564,7 +1893,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_set(united_odom p_imovement, bool slew_on);
+  motion_handle pid_odom_set(united_odom p_imovement, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1572,7 +1901,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements
    */
-  void pid_odom_set(std::vector<odom> imovements);
+  motion_handle pid_odom_set(std::vector<odom> imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1582,7 +1911,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_set(std::vector<odom> imovements, bool slew_on);
+  motion_handle pid_odom_set(std::vector<odom> imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1590,7 +1919,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements
    */
-  void pid_odom_pp_set(std::vector<odom> imovements);
+  motion_handle pid_odom_pp_set(std::vector<odom> imovements);
 
   /**
    * Takes in odom movements to go through multiple points.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1600,7 +1929,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_pp_set(std::vector<odom> imovements, bool slew_on);
+  motion_handle pid_odom_pp_set(std::vector<odom> imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject into the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1608,7 +1937,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements
    */
-  void pid_odom_injected_pp_set(std::vector<odom> imovements);
+  motion_handle pid_odom_injected_pp_set(std::vector<odom> imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject into the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1618,7 +1947,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_injected_pp_set(std::vector<odom> imovements, bool slew_on);
+  motion_handle pid_odom_injected_pp_set(std::vector<odom> imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1626,7 +1955,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements
    */
-  void pid_odom_smooth_pp_set(std::vector<odom> imovements);
+  motion_handle pid_odom_smooth_pp_set(std::vector<odom> imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1636,7 +1965,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_smooth_pp_set(std::vector<odom> imovements, bool slew_on);
+  motion_handle pid_odom_smooth_pp_set(std::vector<odom> imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1644,7 +1973,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements.  values are united here with okapi units
    */
-  void pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements);
+  motion_handle pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1654,7 +1983,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
+  motion_handle pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject into the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1662,7 +1991,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements.  values are united here with okapi units
    */
-  void pid_odom_injected_pp_set(std::vector<united_odom> p_imovements);
+  motion_handle pid_odom_injected_pp_set(std::vector<united_odom> p_imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject into the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1672,7 +2001,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_injected_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
+  motion_handle pid_odom_injected_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1680,7 +2009,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements.  values are united here with okapi units
    */
-  void pid_odom_pp_set(std::vector<united_odom> p_imovements);
+  motion_handle pid_odom_pp_set(std::vector<united_odom> p_imovements);
 
   /**
    * Takes in odom movements to go through multiple points.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1690,7 +2019,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
+  motion_handle pid_odom_pp_set(std::vector<united_odom> p_imovements, bool slew_on);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if globally enabled.
@@ -1698,7 +2027,7 @@ class Drive {
    * \param imovements
    *        {{{x, y, t}, fwd/rev, 1-127}, {{x, y, t}, fwd/rev, 1-127}}  odom movements.  values are united here with okapi units
    */
-  void pid_odom_set(std::vector<united_odom> p_imovements);
+  motion_handle pid_odom_set(std::vector<united_odom> p_imovements);
 
   /**
    * Takes in odom movements to go through multiple points, will inject and smooth the path.  If an angle is set, this will run boomerang for that point.  Uses slew if enabled for this motion.
@@ -1708,7 +2037,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_odom_set(std::vector<united_odom> p_imovements, bool slew_on);
+  motion_handle pid_odom_set(std::vector<united_odom> p_imovements, bool slew_on);
 
   /**
    * Sets the robot to move forward using PID with okapi units, only using slew if globally enabled.
@@ -1718,7 +2047,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_drive_set(okapi::QLength p_target, int speed);
+  motion_handle pid_drive_set(okapi::QLength p_target, int speed);
 
   /**
    * Sets the robot to move forward using PID with okapi units, using slew if enabled for this motion.
@@ -1732,7 +2061,7 @@ class Drive {
    * \param toggle_heading
    *        toggle for heading correction.  true enables, false disables
    */
-  void pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading = true);
+  motion_handle pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading = true);
 
   /**
    * Sets the robot to move forward using PID without okapi units, only using slew if globally enabled.
@@ -1742,7 +2071,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_drive_set(double target, int speed);
+  motion_handle pid_drive_set(double target, int speed);
 
   /**
    * Sets the robot to move forward using PID without okapi units, using slew if enabled for this motion.
@@ -1756,7 +2085,7 @@ class Drive {
    * \param toggle_heading
    *        toggle for heading correction.  true enables, false disables
    */
-  void pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading = true);
+  motion_handle pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading = true);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1766,7 +2095,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_turn_set(pose itarget, drive_directions dir, int speed);
+  motion_handle pid_turn_set(pose itarget, drive_directions dir, int speed);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1778,7 +2107,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(pose itarget, drive_directions dir, int speed, bool slew_on);
+  motion_handle pid_turn_set(pose itarget, drive_directions dir, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1790,7 +2119,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1804,7 +2133,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1814,7 +2143,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_turn_set(united_pose p_itarget, drive_directions dir, int speed);
+  motion_handle pid_turn_set(united_pose p_itarget, drive_directions dir, int speed);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1826,7 +2155,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, bool slew_on);
+  motion_handle pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1838,7 +2167,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn face a point using PID and odometry.
@@ -1852,7 +2181,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn relative to initial heading using PID.
@@ -1864,7 +2193,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(double target, int speed);
+  motion_handle pid_turn_set(double target, int speed);
 
   /**
    * Sets the robot to turn relative to initial heading using PID.
@@ -1876,7 +2205,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_set(double target, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_set(double target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn relative to initial heading using PID, using slew if enabled for this motion.
@@ -1888,7 +2217,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(double target, int speed, bool slew_on);
+  motion_handle pid_turn_set(double target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn relative to initial heading using PID, using slew if enabled for this motion.
@@ -1902,7 +2231,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(double target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_set(double target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn relative to initial heading using PID with okapi units.
@@ -1912,7 +2241,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_turn_set(okapi::QAngle p_target, int speed);
+  motion_handle pid_turn_set(okapi::QAngle p_target, int speed);
 
   /**
    * Sets the robot to turn relative to initial heading using PID with okapi units.
@@ -1924,7 +2253,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn relative to initial heading using PID with okapi units, using slew if enabled for this motion.
@@ -1936,7 +2265,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(okapi::QAngle p_target, int speed, bool slew_on);
+  motion_handle pid_turn_set(okapi::QAngle p_target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn relative to initial heading using PID with okapi units, using slew if enabled for this motion.
@@ -1950,7 +2279,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -1960,7 +2289,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_turn_relative_set(okapi::QAngle p_target, int speed);
+  motion_handle pid_turn_relative_set(okapi::QAngle p_target, int speed);
 
   /**
    * Sets the robot to turn relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -1972,7 +2301,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -1984,7 +2313,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_relative_set(okapi::QAngle p_target, int speed, bool slew_on);
+  motion_handle pid_turn_relative_set(okapi::QAngle p_target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -1998,7 +2327,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2008,7 +2337,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_turn_relative_set(double target, int speed);
+  motion_handle pid_turn_relative_set(double target, int speed);
 
   /**
    * Sets the robot to turn relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2020,7 +2349,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_turn_relative_set(double target, int speed, e_angle_behavior behavior);
+  motion_handle pid_turn_relative_set(double target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2032,7 +2361,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_relative_set(double target, int speed, bool slew_on);
+  motion_handle pid_turn_relative_set(double target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2046,7 +2375,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_turn_relative_set(double target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_turn_relative_set(double target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, only using slew if globally enabled.
@@ -2058,7 +2387,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_set(e_swing type, double target, int speed);
+  motion_handle pid_swing_set(e_swing type, double target, int speed);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, only using slew if globally enabled.
@@ -2072,7 +2401,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, using slew if enabled for this motion.
@@ -2086,7 +2415,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, double target, int speed, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, using slew if enabled for this motion.
@@ -2100,7 +2429,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, only using slew if globally enabled.
@@ -2114,7 +2443,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_set(e_swing type, double target, int speed, int opposite_speed);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, int opposite_speed);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, only using slew if globally enabled.
@@ -2128,7 +2457,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, using slew if enabled for this motion.
@@ -2144,7 +2473,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading without okapi units, using slew if enabled for this motion.
@@ -2162,7 +2491,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, only using slew if globally enabled.
@@ -2174,7 +2503,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, only using slew if globally enabled.
@@ -2188,7 +2517,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, using slew if enabled for this motion.
@@ -2202,7 +2531,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, using slew if enabled for this motion.
@@ -2218,7 +2547,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, only using slew if globally enabled.
@@ -2232,7 +2561,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, only using slew if globally enabled.
@@ -2248,7 +2577,7 @@ class Drive {
    * \param behavior
    *        changes what direction the robot will turn.  can be left, right, shortest, longest, raw
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn using only the left or right side relative to initial heading with okapi units, using slew if enabled for this motion.
@@ -2264,7 +2593,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to initial heading using PID with okapi units, using slew if enabled for this motion.
@@ -2282,7 +2611,7 @@ class Drive {
    * \param slew_on
    *        ramp up from a lower speed to your target speed
    */
-  void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -2294,7 +2623,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -2306,7 +2635,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -2318,7 +2647,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -2330,7 +2659,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -2344,7 +2673,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, only using slew if globally enabled.
@@ -2358,7 +2687,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -2372,7 +2701,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID with okapi units, using slew if enabled for this motion.
@@ -2386,7 +2715,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2398,7 +2727,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2410,7 +2739,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2422,7 +2751,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2434,7 +2763,7 @@ class Drive {
    * \param speed
    *        0 to 127, max speed during motion
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2448,7 +2777,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, only using slew if globally enabled.
@@ -2462,7 +2791,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2476,7 +2805,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on);
 
   /**
    * Sets the robot to turn only using the left or right side relative to current heading using PID without okapi units, using slew if enabled for this motion.
@@ -2490,7 +2819,7 @@ class Drive {
    * \param opposite_speed
    *        -127 to 127, max speed of the opposite side of the drive during the swing. this is used for arcs, and is defaulted to 0
    */
-  void pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
+  motion_handle pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on);
 
   /**
    * Resets all PID targets to 0.
@@ -2507,6 +2836,19 @@ class Drive {
    */
   void drive_angle_set(double angle);
 
+  /**
+   * Returns a handle to the most recent motion.
+   *
+   * Every pid_*_set function also returns this, so you can hold onto it and wait on it or poll it later.
+   * pid_*_set functions are started by ez_auto_task on its next tick, and the handle reports RUNNING until then.
+   */
+  motion_handle pid_motion_get();
+
+  /**
+   * Blocks the calling task until ez_auto_task finishes its next tick.
+   */
+  void pid_tick_wait();
+
   /**
    * Lock the code in a while loop until the robot has settled.
    */
@@ -2604,6 +2946,156 @@ class Drive {
    */
   void pid_wait_until(united_pose target);
 
+  /**
+   * Runs callback once both sides of the drive have passed this distance along the current motion.
+   *
+   * Triggers are checked once per tick in ez_auto_task, so callbacks should be short and must not delay.
+   * Triggers that haven't fired when the motion exits are dropped.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param target
+   *        distance from where the motion started, in inches
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_distance_add(double target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once both sides of the drive have passed this distance along the current motion, with okapi units.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param p_target
+   *        distance from where the motion started, okapi unit
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_distance_add(okapi::QLength p_target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot has turned past this angle during the current motion.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param target
+   *        angle in degrees, the shortest path from the current heading is used
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_angle_add(double target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot has turned past this angle during the current motion, with okapi units.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param p_target
+   *        angle, okapi unit
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_angle_add(okapi::QAngle p_target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once this point of the current pure pursuit path becomes the target.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param index
+   *        index of your input points, 0 is the first point in the index
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_index_add(int index, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot has passed this point during the current motion.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param target
+   *        {x, y} pose for the robot to pass through
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_point_add(pose target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot has passed this point during the current motion, with okapi units.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param p_target
+   *        {x, y} pose with units for the robot to pass through
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_point_add(united_pose p_target, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot is within radius of a point during the current motion.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param target
+   *        {x, y} pose of the point
+   * \param radius
+   *        distance from the point in inches
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_radius_add(pose target, double radius, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback once the robot is within radius of a point during the current motion, with okapi units.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param p_target
+   *        {x, y} pose with units of the point
+   * \param p_radius
+   *        distance from the point, okapi unit
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_radius_add(united_pose p_target, okapi::QLength p_radius, std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback when the current motion exits for any reason, including being cancelled or replaced.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_exit_add(std::function<void()> callback = nullptr);
+
+  /**
+   * Runs callback when the current motion exits because of a velocity or mA exit.
+   *
+   * Returns an id for pid_trigger_fired(), or -1 when every trigger slot is in use.
+   *
+   * \param callback
+   *        function to run when the trigger fires, can be empty if you only want pid_trigger_fired()
+   */
+  int pid_trigger_interfered_add(std::function<void()> callback = nullptr);
+
+  /**
+   * Returns true once a trigger has fired.
+   *
+   * Fired triggers are remembered until their motion is over and their slot is needed again.
+   *
+   * \param id
+   *        id returned when adding the trigger
+   */
+  bool pid_trigger_fired(int id);
+
+  /**
+   * Removes every trigger.
+   */
+  void pid_triggers_clear();
+
   /**
    * Autonomous interference detection.
    *
@@ -2650,6 +3142,75 @@ class Drive {
    */
   int pid_speed_max_get();
 
+  /**
+   * Enables cascaded velocity control in autonomous.
+   *
+   * Instead of sending voltage, the position and heading PIDs output a target speed, where 127 is
+   * pid_drive_velocity_max_get().  A velocity PID with feedforward on each side then holds that speed.  This makes
+   * the speed in pid_drive_set(), pid_turn_set(), etc. a real speed that doesn't change with battery.
+   *
+   * \param toggle
+   *        true enables, false sends voltage like normal
+   */
+  void pid_drive_velocity_mode_set(bool toggle);
+
+  /**
+   * Returns true if cascaded velocity control is enabled.
+   */
+  bool pid_drive_velocity_mode_get();
+
+  /**
+   * Sets the top speed of the drive, this is what 127 means with velocity control.
+   *
+   * This is calculated from wheel rpm and diameter when using integrated encoders, and needs to be set when using trackers.
+   *
+   * \param speed
+   *        inches per second
+   */
+  void pid_drive_velocity_max_set(double speed);
+
+  /**
+   * Sets the top speed of the drive, this is what 127 means with velocity control.
+   *
+   * \param p_speed
+   *        okapi speed unit
+   */
+  void pid_drive_velocity_max_set(okapi::QSpeed p_speed);
+
+  /**
+   * Returns the top speed of the drive in inches per second.
+   */
+  double pid_drive_velocity_max_get();
+
+  /**
+   * Sets the velocity PID constants.  Error is in inches per second and output is voltage, -127 to 127.
+   *
+   * \param p
+   *        proportional term
+   * \param i
+   *        integral term
+   * \param d
+   *        derivative term
+   * \param p_start_i
+   *        error threshold to start integral
+   */
+  void pid_drive_velocity_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+
+  /**
+   * Returns the velocity PID constants.
+   */
+  PID::Constants pid_drive_velocity_constants_get();
+
+  /**
+   * Sets the velocity feedforward.  Output is kV * target speed + kS in the direction of target speed, plus the velocity PID.
+   *
+   * \param kv
+   *        voltage per inch per second, 0 uses 127 / pid_drive_velocity_max_get()
+   * \param ks
+   *        voltage to overcome friction
+   */
+  void pid_drive_velocity_feedforward_set(double kv, double ks = 0.0);
+
   /**
    * Set the turn pid constants object.
    *
@@ -2669,6 +3230,17 @@ class Drive {
    */
   PID::Constants pid_turn_constants_get();
 
+  /**
+   * Sets a gain schedule for turn.  Constants are interpolated from this table every iteration, so small and
+   * large motions can each use their best constants.  This replaces the constants set with pid_turn_constants_set().
+   *
+   * \param key
+   *        ez::TARGET_SCHEDULE keys on how far the motion is in degrees, ez::SPEED_SCHEDULE keys on degrees per second
+   * \param table
+   *        {key, {p, i, d, start_i}} entries to interpolate between.  An empty table disables the schedule
+   */
+  void pid_turn_gain_schedule_set(e_gain_schedule key, std::vector<PID::gain_point> table);
+
   /**
    * Sets the amount that the PID will overshoot target by to maintain momentum into the next motion.
    *
@@ -2715,6 +3287,17 @@ class Drive {
    */
   PID::Constants pid_swing_constants_get();
 
+  /**
+   * Sets a gain schedule for swing.  Constants are interpolated from this table every iteration, so small and
+   * large motions can each use their best constants.  This replaces the constants set with pid_swing_constants_set().
+   *
+   * \param key
+   *        ez::TARGET_SCHEDULE keys on how far the motion is in degrees, ez::SPEED_SCHEDULE keys on degrees per second
+   * \param table
+   *        {key, {p, i, d, start_i}} entries to interpolate between.  An empty table disables the schedule
+   */
+  void pid_swing_gain_schedule_set(e_gain_schedule key, std::vector<PID::gain_point> table);
+
   /**
    * Set the forward swing pid constants object.
    *
@@ -2863,6 +3446,17 @@ class Drive {
    */
   PID::Constants pid_drive_constants_get();
 
+  /**
+   * Sets a gain schedule for drive.  Constants are interpolated from this table every iteration, so small and
+   * large motions can each use their best constants.  This replaces the constants set with pid_drive_constants_set().
+   *
+   * \param key
+   *        ez::TARGET_SCHEDULE keys on how far the motion is in inches, ez::SPEED_SCHEDULE keys on inches per second
+   * \param table
+   *        {key, {p, i, d, start_i}} entries to interpolate between.  An empty table disables the schedule
+   */
+  void pid_drive_gain_schedule_set(e_gain_schedule key, std::vector<PID::gain_point> table);
+
   /**
    * Set the forward pid constants object.
    *
@@ -3422,6 +4016,7 @@ class Drive {
 
 
  private:
+  friend class motion_handle;
   void opcontrol_drive_activebrake_targets_set();
   double odom_smooth_weight_smooth = 0.0;
   double odom_smooth_weight_data = 0.0;
@@ -3430,6 +4025,8 @@ class Drive {
   double odom_ime_track_width_left = 0.0;
   double odom_ime_track_width_right = 0.0;
   bool imu_calibrate_took_too_long = false;
+  std::atomic<bool> initialize_running = false;
+  std::atomic<bool> initialize_done = false;
   bool is_full_pid_tuner_enabled = false;
   std::vector<const_and_name>* used_pid_tuner_pids;
   double opcontrol_speed_max = 127.0;
@@ -3482,7 +4079,7 @@ class Drive {
   double max_boomerang_distance = 12.0;
   double odom_turn_bias_amount = 1.375;
   drive_directions current_drive_direction = fwd;
-  double h_last = 0.0, t_last = 0.0, l_last = 0.0, r_last = 0.0;
+  float h_last = 0.0f, t_last = 0.0f, l_last = 0.0f, r_last = 0.0f;
   pose l_pose{0.0, 0.0, 0.0};
   pose r_pose{0.0, 0.0, 0.0};
   pose central_pose{0.0, 0.0, 0.0};
@@ -3492,8 +4089,6 @@ class Drive {
   double new_current_fake = 0.0;
   bool was_odom_just_set = false;
   std::pair<float, float> decide_vert_sensor(ez::tracking_wheel* tracker, bool is_tracker_enabled, float ime = 0.0, float ime_track = 0.0);
-  pose solve_xy_vert(float p_track_width, float current_t, float delta_vert, float delta_t);
-  pose solve_xy_horiz(float p_track_width, float current_t, float delta_horiz, float delta_t);
   bool was_last_pp_mode_boomerang = false;
   bool global_forward_drive_slew_enabled = false;
   bool global_backward_drive_slew_enabled = false;
@@ -3564,6 +4159,85 @@ class Drive {
   void wait_until_drive(double target);
   void wait_until_turn_swing(double target);
 
+  /**
+   * Motion tracking for motion handles.  Exit conditions are computed once per tick in ez_auto_task,
+   * and tasks waiting on a motion are woken with a task notification.
+   */
+  std::uint32_t motion_id = 0;
+  std::atomic<std::uint32_t> motion_issued = 0;
+  std::array<exit_output, 8> motion_results = {};
+  exit_output motion_primary_exit = RUNNING;
+  exit_output motion_secondary_exit = RUNNING;
+  std::array<std::atomic<pros::task_t>, 8> motion_waiters = {};
+  void motion_start();
+  void motion_finish(std::uint32_t id, exit_output reason);
+  exit_output motion_exit_get(std::uint32_t id);
+  void exit_conditions_iterate();
+  bool motion_waiter_add(pros::task_t task);
+  void motion_waiter_remove(pros::task_t task);
+  void motion_waiters_notify();
+  void motion_tick_wait();
+
+  /**
+   * Triggers, checked once per tick in ez_auto_task.  triggers_armed lets the loop skip all of this when nothing is registered.
+   */
+  enum trigger_kind_ { TRIGGER_DISTANCE,
+                       TRIGGER_ANGLE,
+                       TRIGGER_INDEX,
+                       TRIGGER_POINT,
+                       TRIGGER_RADIUS,
+                       TRIGGER_EXIT,
+                       TRIGGER_INTERFERED };
+  enum trigger_state_ { TRIGGER_FREE,
+                        TRIGGER_CLAIMED,
+                        TRIGGER_ARMED,
+                        TRIGGER_FIRED,
+                        TRIGGER_EXPIRED };
+  struct trigger_ {
+    std::atomic<int> state = TRIGGER_FREE;
+    int id = 0;
+    std::uint32_t motion = 0;
+    trigger_kind_ kind = TRIGGER_EXIT;
+    pose target = {0.0, 0.0, 0.0};  // Point and radius triggers
+    double value = 0.0;             // Left sensor target, angle, radius, or pp index
+    double value_right = 0.0;       // Right sensor target
+    int sgn = 0;                    // Which side of value the robot started on
+    int sgn_right = 0;
+    std::function<void()> callback = nullptr;
+  };
+  std::array<trigger_, 16> triggers;
+  std::atomic<int> triggers_armed = 0;
+  std::atomic<int> trigger_id = 0;
+  trigger_* trigger_claim(trigger_kind_ kind, std::function<void()> callback);
+  int trigger_arm(trigger_* trigger);
+  bool trigger_check(trigger_& trigger);
+  void triggers_iterate();
+
+  /**
+   * Motion commands.  pid_*_set functions fill a command and publish it with an atomic swap, and ez_auto_task
+   * applies it at the start of its next tick, so a motion is never half set up while the loop is reading it.
+   * A newer command replaces one that hasn't been applied yet.  Adjustments change the motion with their id
+   * instead of starting a new one, and are dropped if that motion isn't running anymore.
+   */
+  struct command_ {
+    std::uint32_t id = 0;
+    std::function<void()> apply = nullptr;
+    bool adjust = false;
+  };
+  std::atomic<command_*> command_pending = nullptr;
+  std::atomic<std::uint32_t> command_issued = 0;
+  std::atomic<std::uint32_t> command_applied = 0;
+  std::uint32_t command_id = 0;  // Id of the command ez_auto_task is applying, 0 otherwise
+  std::vector<std::function<void()>> config_pending;  // Settings changes waiting for the start of the next tick
+  pros::Mutex config_mutex;
+  motion_handle motion_command(std::function<void()> apply);
+  void motion_adjust(std::function<void()> apply);
+  void motion_config(std::function<void()> apply);
+  void command_iterate();
+  void command_drop();
+  bool command_on_task();
+  void motion_command_wait();
+
   /**
    * Sets the chassis to voltage.
    *
@@ -3571,8 +4245,20 @@ class Drive {
    *        voltage for left side, -127 to 127
    * \param right
    *        voltage for right side, -127 to 127
+   * \param strafe
+   *        voltage to strafe right with a holonomic drive, -127 to 127
    */
-  void private_drive_set(int left, int right);
+  void private_drive_set(int left, int right, int strafe = 0);
+
+  /**
+   * Sets the drive from autonomous.  With velocity control this is a target speed, otherwise it's voltage.
+   *
+   * \param left
+   *        left side, -127 to 127
+   * \param right
+   *        right side, -127 to 127
+   */
+  void private_drive_auto_set(double left, double right);
 
   /**
    * Returns joystick value clipped to JOYSTICK_THRESH
@@ -3600,6 +4286,184 @@ class Drive {
    */
   int max_speed;
 
+  /**
+   * PTO switching.
+   */
+  std::uint32_t pto_bit(int port);
+  void pto_iterate();
+  std::atomic<std::uint32_t> pto_requested = 0;
+  std::atomic<std::uint32_t> pto_ramping = 0;
+  std::atomic<int> pto_ramp_timer = 0;
+  int pto_ramp_time = 0;
+
+  /**
+   * Current budget.
+   */
+  void budget_iterate();
+  bool budget_enabled = false;
+  int budget_total = 20000;
+  double budget_horizon = 60.0;
+  int budget_drive_priority = 2;
+  int budget_pto_priority = 1;
+  int budget_timer = 0;
+  std::vector<budget_motor> budget_motors;
+  pros::Mutex budget_mutex;  // budget_motors is added to and reported from other tasks
+
+  /**
+   * Battery voltage compensation.
+   */
+  void battery_iterate();
+  bool battery_compensation = false;
+  double battery_nominal = 12.0;
+  double battery_filtered = 0.0;
+
+  /**
+   * Slip detection and traction control.
+   */
+  void slip_iterate();
+  bool slip_enabled = false;
+  double slip_threshold = 15.0;
+  double slip_reduction = 0.8;
+  double slip_recovery = 10.0;
+  double slip_minimum = 40.0;
+  bool slip_left = false;
+  bool slip_right = false;
+  bool slip_first = true;
+  int slip_ticks = 0;
+  double slip_last_left = 0.0;
+  double slip_last_right = 0.0;
+  double slip_last_left_tracker = 0.0;
+  double slip_last_right_tracker = 0.0;
+  double slip_last_theta = 0.0;
+
+  // Sum of the last few ticks, so slip is found from distances instead of single tick encoder noise
+  struct slip_window_ {
+    static constexpr int size = 10;
+    std::array<double, size> values = {};
+    int index = 0;
+    double sum = 0.0;
+
+    // Adds a value and returns the one from size ticks ago that it replaced
+    double push(double value) {
+      double oldest = values[index];
+      values[index] = value;
+      index = (index + 1) % size;
+      sum += value - oldest;
+      return oldest;
+    }
+    void clear() {
+      values.fill(0.0);
+      index = 0;
+      sum = 0.0;
+    }
+  };
+  slip_window_ slip_left_window;
+  slip_window_ slip_right_window;
+  slip_window_ slip_left_expected_window;
+  slip_window_ slip_right_expected_window;
+  slip_window_ slip_center_window;
+  slip_window_ slip_side_window;
+  slip_window_ slip_ime_turn_window;
+  slip_window_ slip_imu_turn_window;
+  slip_window_ slip_imu_speed_window;
+  slip_window_ slip_speed_history;
+  double traction_limit_left = 127.0;
+  double traction_limit_right = 127.0;
+  double traction_last_left = 0.0;
+  double traction_last_right = 0.0;
+
+  /**
+   * Dual imu fusion.
+   */
+  struct imu_state_ {
+    double last = NAN;     // Raw rotation last tick, NAN when there is no valid reading
+    double drift = 0.0;    // Degrees per tick while the robot is still
+    double noise = 1e-4;   // Variance of each tick's change while the robot is still
+    double travel = 0.0;   // Degrees turned, used to match scale to the primary imu
+    bool failed = false;
+  };
+  std::optional<pros::Imu> imu_secondary;        // Only created and read in ez_auto_task
+  std::atomic<int> imu_secondary_port = 0;        // Set once imu_secondary is ready, other tasks check this instead
+  imu_state_ imu_primary_state;
+  imu_state_ imu_secondary_state;
+  double imu_secondary_scale = 1.0;
+  std::atomic<double> imu_fused = 0.0;
+  std::atomic<double> imu_reset_heading = NAN;  // Heading waiting for imu_iterate to apply, NAN when there isn't one
+  void imu_reset_apply(double new_heading);
+
+  /**
+   * Imu acceleration, read at most once per tick and shared by slip detection and the exit conditions.
+   */
+  pros::imu_accel_s_t imu_accel = {0.0, 0.0, 0.0};
+  bool imu_accel_fresh = false;  // Cleared at the start of every tick in sensors_iterate
+  const pros::imu_accel_s_t& imu_accel_tick();
+
+  /**
+   * Imu scale calibration.
+   */
+  double imu_scaler_variance = 0.0;
+  double imu_unscaled_get();
+  double imu_tracker_heading_get();
+  void save_imu_scaler_sd();
+
+  /**
+   * Odom geometry calibration.  Diameters and offsets are in the order left, right, back, front, and 0 means
+   * that value wasn't calibrated.
+   */
+  struct odom_calibration_ {
+    double diameter[4] = {0.0, 0.0, 0.0, 0.0};
+    double offset[4] = {0.0, 0.0, 0.0, 0.0};
+    double track_width = 0.0;
+  };
+  odom_calibration_ odom_calibration;
+  tracking_wheel* odom_calibration_tracker(int index);
+  double odom_calibration_distance_get();
+  void odom_calibration_apply();
+  void save_odom_calibration_sd();
+  void imu_iterate();
+  bool imu_sample(pros::Imu& sensor, imu_state_& state, double& delta, bool still, const char* name);
+
+  /**
+   * Drive motor sensing.  Every motor on a side is sampled once per tick, motors that are unplugged or disagree with the
+   * rest are left out, and the change in position of the rest is averaged into one position for the side.
+   */
+  struct side_sensor_ {
+    std::vector<double> last;  // Position of each motor last tick, NAN when it has no valid reading
+    std::vector<int> strikes;  // Ticks each motor has disagreed with the rest, the motor fails at sensor_strike_limit
+    std::atomic<std::uint32_t> failed = 0;  // pto_bit() of every failed motor, read from any task
+    std::atomic<double> position = 0.0;
+    std::atomic<bool> reset_requested = false;  // Set by any task, the tare happens at the start of the next tick
+    bool first = true;
+  };
+  static constexpr int sensor_strike_limit = 25;
+  side_sensor_ sensor_left;
+  side_sensor_ sensor_right;
+  void sensors_iterate();
+  void sensors_reset();
+  void side_sensor_iterate(std::vector<pros::Motor>& motors, side_sensor_& side, const char* name);
+  void side_sensor_reset(std::vector<pros::Motor>& motors, side_sensor_& side);
+  pros::Motor& side_motor_get(std::vector<pros::Motor>& motors, side_sensor_& side);
+
+  /**
+   * Holonomic drive.
+   */
+  void holonomic_ptp_task();
+  bool holonomic = false;
+  double holonomic_heading = 0.0;
+
+  /**
+   * Cascaded velocity control.
+   */
+  bool velocity_mode = false;
+  double velocity_max = 0.0;
+  double velocity_kv = 0.0;
+  double velocity_ks = 0.0;
+  double velocity_last_left = 0.0;
+  double velocity_last_right = 0.0;
+  double velocity_left_speed = 0.0;   // Measured speed, inches per second
+  double velocity_right_speed = 0.0;  // Measured speed, inches per second
+  std::uint32_t velocity_last_time = 0;
+
   /**
    * Tasks
    */
@@ -3668,8 +4532,33 @@ class Drive {
   /**
    * The left and right curve scalers.
    */
-  double left_curve_scale;
-  double right_curve_scale;
+  double left_curve_scale = 0.0;
+  double right_curve_scale = 0.0;
+
+  /**
+   * Joystick curves, looked up from -127 to 127 and rebuilt when the curve or its scale changes.
+   *
+   * Each side has two copies.  A rebuild fills the one opcontrol isn't reading and then flips
+   * the active index, so the initialize task can load the SD card while the driver is driving.
+   * curve_mutex keeps two rebuilds from filling the same copy.
+   */
+  struct curve_ {
+    std::array<double, 255> table;
+    std::function<double(double, double)> function = nullptr;
+    double scale = 0.0;
+  };
+  curve_ left_curves[2];
+  curve_ right_curves[2];
+  std::atomic<int> left_curve_active = 0;
+  std::atomic<int> right_curve_active = 0;
+  pros::Mutex curve_mutex;
+  std::function<double(double, double)> left_curve_function = nullptr;
+  std::function<double(double, double)> right_curve_function = nullptr;
+  static double curve_5225a(double x, double scale);
+  void curve_table_build(std::array<double, 255>& table, const std::function<double(double, double)>& curve, double scale);
+  void curve_publish(curve_ (&curves)[2], std::atomic<int>& active, const std::function<double(double, double)>& curve, double scale);
+  void curve_tables_build();
+  double curve_lookup(const curve_& curve, double x);
 
   /**
    * Increase and decrease left and right curve scale.
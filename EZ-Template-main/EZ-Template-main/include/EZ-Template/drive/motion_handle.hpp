@@ -0,0 +1,125 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "EZ-Template/util.hpp"
+#include "okapi/api/units/QAngle.hpp"
+#include "okapi/api/units/QLength.hpp"
+
+namespace ez {
+class Drive;
+
+class motion_handle {
+ public:
+  /**
+   * Creates a handle to a motion.  This is returned by every pid_*_set function.
+   *
+   * \param drive
+   *        the drive the motion is running on
+   * \param id
+   *        the id of the motion, this increases every time a new motion starts
+   */
+  motion_handle(Drive* drive, std::uint32_t id);
+
+  /**
+   * Blocks the calling task until this motion has settled.  The task sleeps until the control loop wakes it.
+   *
+   * Returns the reason the motion exited.
+   */
+  exit_output wait();
+
+  /**
+   * Blocks the calling task until this position has passed for turning, swinging or driving without okapi units.
+   *
+   * Returns true when the target was passed, and false when the motion exited before reaching it.
+   *
+   * \param target
+   *        degrees for turns/swings, inches for driving
+   */
+  bool wait_until(double target);
+
+  /**
+   * Blocks the calling task until this position has passed for driving with okapi units.
+   *
+   * Returns true when the target was passed, and false when the motion exited before reaching it.
+   *
+   * \param target
+   *        for driving, using okapi units
+   */
+  bool wait_until(okapi::QLength target);
+
+  /**
+   * Blocks the calling task until this position has passed for turning or swinging with okapi units.
+   *
+   * Returns true when the target was passed, and false when the motion exited before reaching it.
+   *
+   * \param target
+   *        for turning, using okapi units
+   */
+  bool wait_until(okapi::QAngle target);
+
+  /**
+   * Blocks the calling task until this point has been passed.
+   *
+   * Returns true when the point was passed, and false when the motion exited before reaching it.
+   *
+   * \param target
+   *        {x, y} pose for the robot to pass through
+   */
+  bool wait_until(pose target);
+
+  /**
+   * Blocks the calling task until this point has been passed, with okapi units.
+   *
+   * Returns true when the point was passed, and false when the motion exited before reaching it.
+   *
+   * \param target
+   *        {x, y} pose with units for the robot to pass through
+   */
+  bool wait_until(united_pose target);
+
+  /**
+   * Blocks the calling task until a trigger added with one of the Drive::pid_trigger_*_add functions fires.
+   *
+   * Returns true when the trigger fired, and false when the motion exited before it fired.
+   *
+   * \param trigger
+   *        id returned when adding the trigger
+   */
+  bool wait_until_trigger(int trigger);
+
+  /**
+   * Returns true once this motion has settled, was cancelled, or was replaced by a newer motion.
+   */
+  bool done();
+
+  /**
+   * Stops this motion and the drive motors.  Does nothing if a newer motion has started.
+   */
+  void cancel();
+
+  /**
+   * Returns why this motion exited.  RUNNING while the motion is still going.
+   */
+  exit_output exit_reason_get();
+
+  /**
+   * Returns the id of this motion.
+   */
+  std::uint32_t id_get();
+
+ private:
+  Drive* drive;
+  std::uint32_t id;
+  bool wait_for(std::function<bool()> condition);
+  bool wait_until_drive(double target);
+  bool wait_until_turn_swing(double target);
+};
+};  // namespace ez
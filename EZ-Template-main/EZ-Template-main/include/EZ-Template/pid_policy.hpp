@@ -0,0 +1,359 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "EZ-Template/util.hpp"
+
+namespace ez {
+namespace pid {
+/**
+ * Struct for constants.
+ */
+struct constants {
+  double kp;
+  double ki;
+  double kd;
+  double start_i;
+};
+
+/**
+ * Struct for exit condition.
+ */
+struct exit_constants {
+  int small_exit_time = 0;
+  double small_error = 0;
+  int big_exit_time = 0;
+  double big_error = 0;
+  int velocity_exit_time = 0;
+  int mA_timeout = 0;
+};
+
+/**
+ * Derivative policies.  step() returns the derivative term before kD is applied.
+ */
+
+/**
+ * No derivative, for PIDs that are only P or PI.
+ */
+struct derivative_none {
+  double step(double current, double previous) { return 0.0; }
+  void reset() {}
+};
+
+/**
+ * Derivative on measurement instead of error to avoid "derivative kick".
+ */
+struct derivative_measurement {
+  double step(double current, double previous) { return current - previous; }
+  void reset() {}
+};
+
+/**
+ * Derivative on measurement passed through a first order low pass filter, to smooth out noisy sensors.
+ *
+ * filter is 0 to 1, 0 is no filtering and higher values smooth more but react slower.
+ */
+struct derivative_filtered {
+  double filter = 0.0;
+  double last = 0.0;
+
+  double step(double current, double previous) {
+    last = (filter * last) + ((1.0 - filter) * (current - previous));
+    return last;
+  }
+  void reset() { last = 0.0; }
+};
+
+/**
+ * Integral policies.  step() updates the accumulated integral before kI is applied, and saturated() is
+ * told how much output was lost to clamping.
+ */
+
+/**
+ * No integral, for PIDs that are only P or PD.
+ */
+struct integral_none {
+  void step(double& integral, double error, double previous, const constants& k) {}
+  void saturated(double& integral, double excess, const constants& k) {}
+};
+
+/**
+ * Only integrates while error is within start_i, and resets when the sign of error flips.  Nothing accumulates
+ * while ki is 0, so scheduling ki back on doesn't start from a wound up integral.
+ */
+struct integral_band {
+  bool reset_on_flip = true;
+
+  void step(double& integral, double error, double previous, const constants& k) {
+    if (k.ki == 0.0) {
+      integral = 0;
+      return;
+    }
+
+    // Only compute i when within a threshold of target
+    if (fabs(error) < k.start_i)
+      integral += error;
+
+    // Reset i when the sign of error flips
+    if (util::sgn(error) != util::sgn(previous) && reset_on_flip)
+      integral = 0;
+  }
+  void saturated(double& integral, double excess, const constants& k) {}
+};
+
+/**
+ * integral_band with back calculation anti-windup.  When output is clamped, i is pulled back by gain * the
+ * amount that was clamped off, so it doesn't keep growing while the mechanism can't go any faster.
+ */
+struct integral_back_calculation : integral_band {
+  double gain = 0.0;
+
+  void saturated(double& integral, double excess, const constants& k) {
+    if (k.ki != 0.0) integral += gain * excess / k.ki;
+  }
+};
+
+/**
+ * Output policies.  apply() takes the raw PID output and returns what gets sent out.
+ */
+
+/**
+ * Raw output, limits are handled by whatever uses the PID.
+ */
+struct output_unclamped {
+  double apply(double output) { return output; }
+};
+
+/**
+ * Clamps output to +-max.
+ */
+struct output_clamped {
+  double max = 127.0;
+  double apply(double output) { return std::clamp(output, -max, max); }
+};
+
+/**
+ * Exit condition policies.  step() is called once per tick with the exit constants, the velocity that counts as
+ * stopped, error and velocity, and returns RUNNING until the PID has settled.
+ */
+
+/**
+ * Never exits by itself, for PIDs that hold a target forever.
+ */
+struct exit_none {
+  exit_output step(const exit_constants& exit, double velocity_zero, double error, double velocity) { return RUNNING; }
+  void reset() {}
+};
+
+/**
+ * The small error, big error and velocity timers used by ez::PID.
+ */
+struct exit_timers {
+  int small_timer = 0;
+  int big_timer = 0;
+  int velocity_timer = 0;
+
+  exit_output step(const exit_constants& exit, double velocity_zero, double error, double velocity) {
+    // If the robot gets within the target, make sure it's there for small_timeout amount of time
+    if (exit.small_error != 0) {
+      if (fabs(error) < exit.small_error) {
+        small_timer += util::DELAY_TIME;
+        big_timer = 0;  // While this is running, don't run big thresh
+        if (small_timer > exit.small_exit_time) {
+          reset();
+          return SMALL_EXIT;
+        }
+      } else {
+        small_timer = 0;
+      }
+    }
+
+    // If the robot is close to the target, start a timer.  If the robot doesn't get closer within
+    // a certain amount of time, exit and continue.  This does not run while small_timeout is running
+    else if (exit.big_error != 0 && exit.big_exit_time != 0) {
+      if (fabs(error) < exit.big_error) {
+        big_timer += util::DELAY_TIME;
+        if (big_timer > exit.big_exit_time) {
+          reset();
+          return BIG_EXIT;
+        }
+      } else {
+        big_timer = 0;
+      }
+    }
+
+    // If the velocity is 0, the code will timeout
+    if (exit.velocity_exit_time != 0) {
+      if (fabs(velocity) <= velocity_zero) {
+        velocity_timer += util::DELAY_TIME;
+        if (velocity_timer > exit.velocity_exit_time) {
+          reset();
+          return VELOCITY_EXIT;
+        }
+      } else {
+        velocity_timer = 0;
+      }
+    }
+
+    return RUNNING;
+  }
+
+  void reset() {
+    small_timer = 0;
+    big_timer = 0;
+    velocity_timer = 0;
+  }
+};
+
+/**
+ * PID with behavior chosen at compile time.
+ *
+ * Each policy is inlined into compute(), so there are no runtime checks for features that aren't used,
+ * and empty policies take up no space.  ez::PID is core<derivative_filtered, integral_back_calculation,
+ * output_unclamped, exit_timers> with runtime settings on top.
+ *
+ * ie, a P loop that clamps to 127 and never exits:
+ * ez::pid::core<ez::pid::derivative_none, ez::pid::integral_none, ez::pid::output_clamped> lift_pid(2.0);
+ *
+ * ie, a PID that exits once it's within 1 unit for 100ms:
+ * ez::pid::core<ez::pid::derivative_measurement, ez::pid::integral_band, ez::pid::output_unclamped, ez::pid::exit_timers> arm_pid(2.0, 0.0, 10.0);
+ * arm_pid.exit = {100, 1.0};
+ */
+template <class Derivative, class Integral, class Output, class Exit = exit_none>
+class core {
+ public:
+  /**
+   * Constructor with constants.
+   *
+   * \param p
+   *        kP
+   * \param i
+   *        ki
+   * \param d
+   *        kD
+   * \param start_i
+   *        error value that i starts within
+   */
+  core(double p = 0, double i = 0, double d = 0, double start_i = 0) { constants_set(p, i, d, start_i); }
+
+  /**
+   * Set constants for PID.
+   *
+   * \param p
+   *        kP
+   * \param i
+   *        ki
+   * \param d
+   *        kD
+   * \param start_i
+   *        error value that i starts within
+   */
+  void constants_set(double p, double i = 0, double d = 0, double start_i = 0) { constants = {p, i, d, start_i}; }
+
+  /**
+   * Sets PID target.
+   *
+   * \param input
+   *        new target for PID
+   */
+  void target_set(double input) { target = input; }
+
+  /**
+   * Computes PID.
+   *
+   * \param current
+   *        current sensor value
+   */
+  double compute(double current) { return compute_error(target - current, current); }
+
+  /**
+   * Computes PID, but you compute the error yourself.
+   *
+   * \param err
+   *        error for the PID, you need to calculate this yourself
+   * \param current
+   *        current sensor value
+   */
+  double compute_error(double err, double current) { return step(err, err, current, constants); }
+
+  /**
+   * One PID update, compute() and compute_error() are both this.
+   *
+   * \param err
+   *        error for the PID
+   * \param p_err
+   *        error kP acts on, this is err unless something like setpoint weighting changes it
+   * \param current
+   *        current sensor value
+   * \param gains
+   *        constants to use for this update
+   */
+  double step(double err, double p_err, double current, const pid::constants& gains) {
+    error = err;
+    velocity = current - prev_current;
+    derivative = derivative_policy.step(current, prev_current);
+    integral_policy.step(integral, error, prev_error, gains);
+
+    double raw = (p_err * gains.kp) + (integral * gains.ki) - (derivative * gains.kd);
+    output = output_policy.apply(raw);
+    integral_policy.saturated(integral, output - raw, gains);
+
+    prev_current = current;
+    prev_error = error;
+    return output;
+  }
+
+  /**
+   * Iterative exit condition for PID, call this once per tick after compute().
+   */
+  exit_output exit_condition() { return exit_policy.step(exit, velocity_zero, error, velocity); }
+
+  /**
+   * Resets all variables to 0.  This does not reset constants.
+   */
+  void variables_reset() {
+    output = error = integral = derivative = velocity = prev_error = prev_current = 0;
+    derivative_policy.reset();
+    exit_policy.reset();
+  }
+
+  /**
+   * Constants.
+   */
+  pid::constants constants = {0, 0, 0, 0};
+
+  /**
+   * Exit constants, and the velocity that counts as stopped.  Only used when Exit isn't exit_none.
+   */
+  exit_constants exit;
+  double velocity_zero = 0.05;
+
+  /**
+   * Policies, these can be configured directly, ie output_policy.max = 100;
+   */
+  [[no_unique_address]] Derivative derivative_policy;
+  [[no_unique_address]] Integral integral_policy;
+  [[no_unique_address]] Output output_policy;
+  [[no_unique_address]] Exit exit_policy;
+
+  /**
+   * PID variables.
+   */
+  double output = 0.0;
+  double error = 0.0;
+  double target = 0.0;
+  double integral = 0.0;
+  double derivative = 0.0;
+  double velocity = 0.0;
+  double prev_error = 0.0;
+  double prev_current = 0.0;
+};
+}  // namespace pid
+};  // namespace ez
@@ -68,7 +68,8 @@ enum exit_output { RUNNING = 1,
                    BIG_EXIT = 3,
                    VELOCITY_EXIT = 4,
                    mA_EXIT = 5,
-                   ERROR_NO_CONSTANTS = 6 };
+                   ERROR_NO_CONSTANTS = 6,
+                   CANCEL_EXIT = 7 };
 
 /**
  * Enum for split and single stick arcade.
@@ -108,6 +109,12 @@ enum e_angle_behavior { raw = 0,
                         shortest = 3,
                         longest = 4 };
 
+/**
+ * Enum for what a gain schedule is keyed on.
+ */
+enum e_gain_schedule { TARGET_SCHEDULE = 0,
+                       SPEED_SCHEDULE = 1 };
+
 const double ANGLE_NOT_SET = 0.0000000000000000000001;
 const okapi::QAngle p_ANGLE_NOT_SET = 0.0000000000000000000001_deg;
 
@@ -264,12 +271,37 @@ double absolute_angle_to_point(pose itarget, pose icurrent);
 double distance_to_point(pose itarget, pose icurrent);
 
 /**
- * Constrains an angle between 180 and -180.
+ * Rounds up to a whole number, used by the angle math so it can be constexpr.
+ *
+ * \param input
+ *        any number that fits in a long long
+ */
+constexpr double angle_ceil(double input) {
+  long long whole = static_cast<long long>(input);
+  return static_cast<double>(whole + (static_cast<double>(whole) < input));
+}
+static_assert(angle_ceil(1.5) == 2.0 && angle_ceil(-1.5) == -1.0);
+static_assert(angle_ceil(2.0) == 2.0 && angle_ceil(-2.0) == -2.0 && angle_ceil(0.0) == 0.0);
+static_assert(angle_ceil(1000000.125) == 1000001.0);
+
+/**
+ * Constrains an angle between 180 and -180.  Angles past 180 in either direction keep their sign at exactly 180.
+ *
+ * This takes the same time no matter how many times the imu has gone around.
  *
  * \param theta
  *        input angle in degrees
  */
-double wrap_angle(double theta);
+constexpr double wrap_angle(double theta) {
+  if (theta > 180.0) return theta - (360.0 * angle_ceil((theta - 180.0) / 360.0));
+  if (theta < -180.0) return theta + (360.0 * angle_ceil((-180.0 - theta) / 360.0));
+  return theta;
+}
+static_assert(wrap_angle(180.0) == 180.0 && wrap_angle(-180.0) == -180.0);
+static_assert(wrap_angle(181.0) == -179.0 && wrap_angle(-181.0) == 179.0);
+static_assert(wrap_angle(540.0) == 180.0 && wrap_angle(-540.0) == -180.0);
+static_assert(wrap_angle(720.0) == 0.0);
+static_assert(wrap_angle(360000090.0) == 90.0 && wrap_angle(-360000090.0) == -90.0);  // a million turns of the imu
 
 /**
  * Returns a new pose that is projected off of the current pose.
@@ -305,6 +337,128 @@ double turn_shortest(double target, double current, bool print = false);
  */
 double turn_longest(double target, double current, bool print = false);
 
+/**
+ * Returns the closest angle to current that points the same way as target.  This is turn_shortest() without printing.
+ *
+ * \param target
+ *        target value in degrees
+ * \param current
+ *        current value in degrees
+ */
+constexpr double angle_shortest(double target, double current) {
+  double error = target - current;
+  if (error < 180.0 && error > -180.0) return target;
+  double wrapped = wrap_angle(error);
+  return wrapped == 0.0 ? current : current + wrapped;
+}
+static_assert(angle_shortest(350.0, 0.0) == -10.0 && angle_shortest(10.0, 350.0) == 370.0);
+static_assert(angle_shortest(180.0, 0.0) == 180.0 && angle_shortest(-180.0, 0.0) == -180.0);
+static_assert(angle_shortest(540.0, 0.0) == 180.0 && angle_shortest(0.0, 730.0) == 720.0);
+static_assert(angle_shortest(90.0, 360000000.0) == 360000090.0);
+
+/**
+ * Returns the angle that points the same way as target but goes the other way around.  This is turn_longest() without
+ * printing.
+ *
+ * \param target
+ *        target value in degrees
+ * \param current
+ *        current value in degrees
+ */
+constexpr double angle_longest(double target, double current) {
+  double shortest = angle_shortest(target, current);
+  double error = shortest - current;
+  return shortest - (360.0 * ((error > 0.0) - (error < 0.0)));
+}
+static_assert(angle_longest(350.0, 0.0) == 350.0 && angle_shortest(350.0, 0.0) == -10.0);
+static_assert(angle_longest(10.0, 350.0) == 10.0 && angle_shortest(10.0, 350.0) == 370.0);
+static_assert(angle_longest(90.0, 0.0) == -270.0);
+static_assert(angle_longest(90.0, 360000000.0) == 359999730.0);
+
+/**
+ * Returns the angle that points the same way as target while turning left, or counterclockwise.
+ *
+ * \param target
+ *        target value in degrees
+ * \param current
+ *        current value in degrees
+ */
+constexpr double angle_left(double target, double current) {
+  double shortest = angle_shortest(target, current);
+  return shortest - current < 0.0 ? shortest : angle_longest(target, current);
+}
+static_assert(angle_left(-90.0, 0.0) == -90.0 && angle_left(90.0, 0.0) == -270.0);
+static_assert(angle_left(180.0, 0.0) == -180.0 && angle_left(10.0, 350.0) == 10.0);
+static_assert(angle_left(90.0, 360000000.0) == 359999730.0);
+
+/**
+ * Returns the angle that points the same way as target while turning right, or clockwise.
+ *
+ * \param target
+ *        target value in degrees
+ * \param current
+ *        current value in degrees
+ */
+constexpr double angle_right(double target, double current) {
+  double shortest = angle_shortest(target, current);
+  return shortest - current > 0.0 ? shortest : angle_longest(target, current);
+}
+static_assert(angle_right(90.0, 0.0) == 90.0 && angle_right(-90.0, 0.0) == 270.0);
+static_assert(angle_right(180.0, 0.0) == 180.0 && angle_right(10.0, 350.0) == 370.0);
+static_assert(angle_right(-90.0, 360000000.0) == 360000270.0);
+
+/**
+ * How many odometry hypotheses odom_solve_xy() moves every tick, left, right and central.
+ */
+constexpr int ODOM_HYPOTHESES = 3;
+
+/**
+ * Moves every vertical odometry hypothesis and the horizontal sensor by one tick.  The arc only depends on the
+ * angle, so sin and cos are found once and the loop is the same math for every hypothesis.
+ *
+ * \param current_t
+ *        heading this tick in radians, math standard
+ * \param delta_t
+ *        change in heading since last tick in radians
+ * \param delta_horiz
+ *        how far the horizontal sensor moved
+ * \param horiz_width
+ *        distance from the horizontal sensor to the center of the robot
+ * \param delta_vert
+ *        how far each vertical hypothesis moved
+ * \param vert_width
+ *        distance from each vertical hypothesis to the center of the robot
+ * \param x
+ *        output, change in x for each hypothesis
+ * \param y
+ *        output, change in y for each hypothesis
+ */
+inline void odom_solve_xy(float current_t, float delta_t, float delta_horiz, float horiz_width, const float* delta_vert, const float* vert_width, float* x, float* y) {
+  // Going straight is the same as an arc with no width
+  float half_delta_t = delta_t / 2.0f;
+  float scale = 1.0f, width_scale = 0.0f;
+  if (delta_t != 0.0f) {
+    width_scale = sinf(half_delta_t) * 2.0f;
+    scale = width_scale / delta_t;
+  }
+
+  float alpha = current_t - half_delta_t;
+  float sin_alpha = sinf(alpha);
+  float cos_alpha = cosf(alpha);
+
+  // xy is calculated internally using math standard but translated to what's intuitive
+  // where going forward from 0 degrees increases Y
+  float local_y = (delta_horiz * scale) + (horiz_width * width_scale);
+  float horiz_x = -cos_alpha * local_y;
+  float horiz_y = -sin_alpha * local_y;
+
+  for (int i = 0; i < ODOM_HYPOTHESES; i++) {
+    float local_x = (delta_vert[i] * scale) - (vert_width[i] * width_scale);
+    x[i] = (-sin_alpha * local_x) + horiz_x;
+    y[i] = (cos_alpha * local_x) + horiz_y;
+  }
+}
+
 /**
  * Converts pose with okapi units to a pose without okapi units.
  *
@@ -7,40 +7,33 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #include "EZ-Template/api.hpp"
 #include "api.h"
 
+// Every combination of policies documented in pid_policy.hpp is built here, so a policy that stops fitting core fails to compile
+template class ez::pid::core<ez::pid::derivative_none, ez::pid::integral_none, ez::pid::output_clamped>;
+template class ez::pid::core<ez::pid::derivative_measurement, ez::pid::integral_band, ez::pid::output_unclamped, ez::pid::exit_timers>;
+template class ez::pid::core<ez::pid::derivative_filtered, ez::pid::integral_back_calculation, ez::pid::output_unclamped, ez::pid::exit_timers>;
+
 using namespace ez;
 
 void PID::variables_reset() {
-  output = 0;
+  core::variables_reset();
   target = 0;
-  error = 0;
-  prev_error = 0;
-  integral = 0;
   time = 0;
   prev_time = 0;
+  new_target = true;
 }
 
 PID::PID() {
   variables_reset();
-  constants_set(0, 0, 0, 0);
 }
 
 PID::Constants PID::constants_get() { return constants; }
 
 // PID constructor with constants
-PID::PID(double p, double i, double d, double start_i, std::string name) {
+PID::PID(double p, double i, double d, double start_i, std::string name) : core(p, i, d, start_i) {
   variables_reset();
-  constants_set(p, i, d, start_i);
   name_set(name);
 }
 
-// Set PID constants
-void PID::constants_set(double p, double i, double d, double p_start_i) {
-  constants.kp = p;
-  constants.ki = i;
-  constants.kd = d;
-  constants.start_i = p_start_i;
-}
-
 bool PID::constants_set_check() {
   if (constants.kp == 0.0 && constants.ki == 0.0 && constants.kd == 0.0 && constants.start_i == 0.0)
     return false;
@@ -57,52 +50,101 @@ void PID::exit_condition_set(int p_small_exit_time, double p_small_error, int p_
   exit.mA_timeout = p_mA_timeout;
 }
 
-void PID::target_set(double input) { target = input; }
+void PID::target_set(double input) {
+  target = input;
+  new_target = true;
+}
 double PID::target_get() { return target; }
 
-void PID::i_reset_toggle(bool toggle) { reset_i_sgn = toggle; }
+void PID::i_reset_toggle(bool toggle) {
+  reset_i_sgn = toggle;
+  integral_policy.reset_on_flip = toggle;
+}
 bool PID::i_reset_get() { return reset_i_sgn; };
 
 double PID::compute(double current) {
-  return compute_error(target - current, current);
+  // Setpoint weighting is relative to where the motion started, so absolute sensor values still work
+  if (new_target) {
+    setpoint_start = current;
+    new_target = false;
+  }
+
+  error = target - current;
+  cur = current;
+  p_error = error - ((1.0 - setpoint_weight) * (target - setpoint_start));
+
+  return raw_compute();
 }
 
 double PID::compute_error(double err, double current) {
   error = err;
   cur = current;
+  p_error = err;
 
   return raw_compute();
 }
 
-double PID::raw_compute() {
-  // calculate derivative on measurement instead of error to avoid "derivative kick"
-  // https://www.isa.org/intech-home/2023/june-2023/features/fundamentals-pid-control
-  derivative = cur - prev_current;
+void PID::derivative_filter_set(double filter) { derivative_policy.filter = util::clamp(filter, 1.0, 0.0); }
+double PID::derivative_filter_get() { return derivative_policy.filter; }
 
-  if (constants.ki != 0) {
-    // Only compute i when within a threshold of target
-    if (fabs(error) < constants.start_i)
-      integral += error;
+void PID::anti_windup_set(double gain) { integral_policy.gain = gain; }
+double PID::anti_windup_get() { return integral_policy.gain; }
 
-    // Reset i when the sign of error flips
-    if (util::sgn(error) != util::sgn(prev_current) && reset_i_sgn)
-      integral = 0;
-  }
+void PID::output_saturated_set(double saturated) { integral_policy.saturated(integral, saturated - output, constants_active()); }
 
-  output = (error * constants.kp) + (integral * constants.ki) - (derivative * constants.kd);
+void PID::gain_schedule_set(e_gain_schedule key, std::vector<gain_point> table) {
+  // Keep the table sorted so lookups can binary search
+  std::sort(table.begin(), table.end(), [](const gain_point& a, const gain_point& b) { return a.key < b.key; });
+  schedule = table;
+  schedule_key = key;
+  schedule_constants = constants;
+}
+void PID::gain_schedule_clear() { schedule.clear(); }
+bool PID::gain_schedule_enabled() { return !schedule.empty(); }
+
+PID::Constants PID::gain_schedule_get(double key) {
+  if (schedule.empty()) return constants;
+
+  // Find the first entry past key, anything outside the table uses the closest entry
+  auto upper = std::upper_bound(schedule.begin(), schedule.end(), key, [](double value, const gain_point& point) { return value < point.key; });
+  if (upper == schedule.begin()) return schedule.front().constants;
+  if (upper == schedule.end()) return schedule.back().constants;
+
+  // Linearly blend between the entries on either side of key
+  const gain_point& lower = *(upper - 1);
+  double t = (key - lower.key) / (upper->key - lower.key);
+  auto blend = [t](double a, double b) { return a + ((b - a) * t); };
+  return {blend(lower.constants.kp, upper->constants.kp),
+          blend(lower.constants.ki, upper->constants.ki),
+          blend(lower.constants.kd, upper->constants.kd),
+          blend(lower.constants.start_i, upper->constants.start_i)};
+}
 
-  prev_current = cur;
-  prev_error = error;
+void PID::gain_schedule_iterate(double current) {
+  if (schedule.empty()) return;
 
-  return output;
+  double key = 0.0;
+  if (schedule_key == TARGET_SCHEDULE)
+    key = fabs(target - (new_target ? current : setpoint_start));  // Size of the whole motion
+  else if (!new_target)
+    key = fabs(current - prev_current) * (1000.0 / util::DELAY_TIME);  // Sensor units per second
+  schedule_constants = gain_schedule_get(key);
 }
 
+// The schedule's constants while one is set, otherwise the user's
+const PID::Constants& PID::constants_active() { return schedule.empty() ? constants : schedule_constants; }
+
+void PID::setpoint_weight_set(double weight) { setpoint_weight = weight; }
+double PID::setpoint_weight_get() { return setpoint_weight; }
+
+// calculate derivative on measurement instead of error to avoid "derivative kick"
+// https://www.isa.org/intech-home/2023/june-2023/features/fundamentals-pid-control
+double PID::raw_compute() { return step(error, p_error, cur, constants_active()); }
+
 void PID::timers_reset() {
-  i = 0;
-  k = 0;
-  j = 0;
-  l = 0;
-  m = 0;
+  exit_policy.reset();
+  mA_timer = 0;
+  secondary_timer = 0;
   is_mA = false;
 }
 
@@ -125,61 +167,60 @@ bool PID::velocity_sensor_secondary_toggle_get() { return use_second_sensor; }
 void PID::velocity_sensor_secondary_set(double secondary_sensor) { second_sensor = secondary_sensor; }
 double PID::velocity_sensor_secondary_get() { return second_sensor; }
 
-void PID::velocity_sensor_main_exit_set(double zero) { velocity_zero_main = zero; }
-double PID::velocity_sensor_main_exit_get() { return velocity_zero_main; }
+void PID::velocity_sensor_main_exit_set(double zero) { velocity_zero = zero; }
+double PID::velocity_sensor_main_exit_get() { return velocity_zero; }
 
 void PID::velocity_sensor_secondary_exit_set(double zero) { velocity_zero_secondary = zero; }
 double PID::velocity_sensor_secondary_exit_get() { return velocity_zero_secondary; }
 
+// Binding copies the motors once, so exit_condition() never has to build a vector
+// pros::Motor can't be assigned, so the list is rebuilt instead of copied over
+void PID::exit_condition_motors_set(pros::Motor sensor) { exit_condition_motors_set(std::vector<pros::Motor>{sensor}); }
+void PID::exit_condition_motors_set(const std::vector<pros::Motor>& sensor) {
+  current_motors.clear();
+  current_motors.reserve(sensor.size());
+  for (const auto& motor : sensor) {
+    current_motors.push_back(motor);
+  }
+}
+void PID::exit_condition_motors_set(const pros::MotorGroup& sensor) {
+  current_motors.clear();
+  current_motors.reserve(sensor.size());
+  for (int index = 0; index < sensor.size(); index++) {
+    current_motors.push_back(pros::Motor(sensor.get_port(index)));
+  }
+}
+void PID::exit_condition_motors_clear() { current_motors.clear(); }
+const std::vector<pros::Motor>& PID::exit_condition_motors_get() { return current_motors; }
+
+// Returns true when 1 bound motor is pulling too many mA
+bool PID::current_motors_over() {
+  for (const auto& motor : current_motors) {
+    if (motor.is_over_current()) return true;
+  }
+  return false;
+}
+
 exit_output PID::exit_condition(bool print) {
+  // Only read current when motors are bound and the mA exit is enabled
+  if (!current_motors.empty() && exit.mA_timeout != 0)
+    return exit_condition_mA(current_motors_over(), print);
+  return exit_condition_iterate(print);
+}
+
+exit_output PID::exit_condition_iterate(bool print) {
   // If this function is called while all exit constants are 0, print an error
   if (exit.small_error == 0 && exit.small_exit_time == 0 && exit.big_error == 0 && exit.big_exit_time == 0 && exit.velocity_exit_time == 0 && exit.mA_timeout == 0) {
     exit_condition_print(ERROR_NO_CONSTANTS);
     return ERROR_NO_CONSTANTS;
   }
 
-  // If the robot gets within the target, make sure it's there for small_timeout amount of time
-  if (exit.small_error != 0) {
-    if (abs(error) < exit.small_error) {
-      j += util::DELAY_TIME;
-      i = 0;  // While this is running, don't run big thresh
-      if (j > exit.small_exit_time) {
-        timers_reset();
-        if (print) exit_condition_print(SMALL_EXIT);
-        return SMALL_EXIT;
-      }
-    } else {
-      j = 0;
-    }
-  }
-
-  // If the robot is close to the target, start a timer.  If the robot doesn't get closer within
-  // a certain amount of time, exit and continue.  This does not run while small_timeout is running
-  else if (exit.big_error != 0 && exit.big_exit_time != 0) {  // Check if this condition is enabled
-    if (abs(error) < exit.big_error) {
-      i += util::DELAY_TIME;
-      if (i > exit.big_exit_time) {
-        timers_reset();
-        if (print) exit_condition_print(BIG_EXIT);
-        return BIG_EXIT;
-      }
-    } else {
-      i = 0;
-    }
-  }
-
-  // If the motor velocity is 0, the code will timeout and set interfered to true.
-  if (exit.velocity_exit_time != 0) {  // Check if this condition is enabled
-    if (abs(derivative) <= velocity_zero_main) {
-      k += util::DELAY_TIME;
-      if (k > exit.velocity_exit_time) {
-        timers_reset();
-        if (print) exit_condition_print(VELOCITY_EXIT);
-        return VELOCITY_EXIT;
-      }
-    } else {
-      k = 0;
-    }
+  // Small error, big error and main sensor velocity timers
+  exit_output timers_exit = core::exit_condition();
+  if (timers_exit != RUNNING) {
+    timers_reset();
+    if (print) exit_condition_print(timers_exit);
+    return timers_exit;
   }
 
   if (!use_second_sensor)
@@ -188,73 +229,69 @@ exit_output PID::exit_condition(bool print) {
   // If the secondary sensors velocity is 0, the code will timeout and set interfered to true.
   if (exit.velocity_exit_time != 0) {  // Check if this condition is enabled
     if (abs(second_sensor) <= velocity_zero_secondary) {
-      m += util::DELAY_TIME;
-      if (m > exit.velocity_exit_time) {
+      secondary_timer += util::DELAY_TIME;
+      if (secondary_timer > exit.velocity_exit_time) {
         timers_reset();
         if (print) exit_condition_print(VELOCITY_EXIT);
         return VELOCITY_EXIT;
       }
     } else {
-      m = 0;
+      secondary_timer = 0;
     }
   }
 
-  // printf("j: %i   i: %i   k: %i   m: %i\n", j, i, k, m);
-
   return RUNNING;
 }
 
-exit_output PID::exit_condition(pros::Motor sensor, bool print) {
+exit_output PID::exit_condition_mA(bool over_current, bool print) {
   // If the motors are pulling too many mA, the code will timeout and set interfered to true.
   if (exit.mA_timeout != 0) {  // Check if this condition is enabled
-    if (sensor.is_over_current()) {
-      l += util::DELAY_TIME;
-      if (l > exit.mA_timeout) {
+    is_mA = over_current;
+    if (is_mA) {
+      mA_timer += util::DELAY_TIME;
+      if (mA_timer > exit.mA_timeout) {
         timers_reset();
         if (print) exit_condition_print(mA_EXIT);
         return mA_EXIT;
       }
     } else {
-      l = 0;
+      mA_timer = 0;
     }
   }
 
-  return exit_condition(print);
+  return exit_condition_iterate(print);
 }
 
-exit_output PID::exit_condition(std::vector<pros::Motor> sensor, bool print) {
-  // If the motors are pulling too many mA, the code will timeout and set interfered to true.
-  if (exit.mA_timeout != 0) {  // Check if this condition is enabled
-    for (auto i : sensor) {
-      // Check if 1 motor is pulling too many mA
-      if (i.is_over_current()) {
-        is_mA = true;
+exit_output PID::exit_condition(pros::Motor sensor, bool print) {
+  // Only read current when the mA exit is enabled
+  bool over_current = exit.mA_timeout != 0 && sensor.is_over_current();
+  return exit_condition_mA(over_current, print);
+}
+
+exit_output PID::exit_condition(const std::vector<pros::Motor>& sensor, bool print) {
+  // Check if 1 motor is pulling too many mA, only when the mA exit is enabled
+  bool over_current = false;
+  if (exit.mA_timeout != 0) {
+    for (const auto& motor : sensor) {
+      if (motor.is_over_current()) {
+        over_current = true;
         break;
       }
-      // If all of the motors aren't drawing too many mA, keep bool false
-      else {
-        is_mA = false;
-      }
-    }
-    if (is_mA) {
-      l += util::DELAY_TIME;
-      if (l > exit.mA_timeout) {
-        timers_reset();
-        if (print) exit_condition_print(mA_EXIT);
-        return mA_EXIT;
-      }
-    } else {
-      l = 0;
     }
   }
-
-  return exit_condition(print);
+  return exit_condition_mA(over_current, print);
 }
 
-exit_output PID::exit_condition(pros::MotorGroup sensor, bool print) {
-  std::vector<pros::Motor> vector_sensor;
-  for (i = 0; i < sensor.size(); i++) {
-    vector_sensor.push_back(pros::Motor(sensor.get_port(i)));
+exit_output PID::exit_condition(const pros::MotorGroup& sensor, bool print) {
+  // Check each motor in the group by index, only when the mA exit is enabled
+  bool over_current = false;
+  if (exit.mA_timeout != 0) {
+    for (int index = 0; index < sensor.size(); index++) {
+      if (sensor.is_over_current(index)) {
+        over_current = true;
+        break;
+      }
+    }
   }
-  return exit_condition(vector_sensor, print);
-}
\ No newline at end of file
+  return exit_condition_mA(over_current, print);
+}
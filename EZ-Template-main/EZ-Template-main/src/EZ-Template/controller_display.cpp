@@ -0,0 +1,86 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/controller_display.hpp"
+
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+ControllerDisplay ez::master_display(&master);
+
+static const std::size_t controller_width = 15;
+
+// Lines start out unknown so the first update always gets sent
+ControllerDisplay::ControllerDisplay(pros::Controller* input_controller, int interval)
+    : controller(input_controller),
+      update_interval(interval),
+      sent{"\n", "\n", "\n"},
+      task([this] { this->task_loop(); }) {}
+
+void ControllerDisplay::set_text(int line, std::string text) {
+  if (line < 0 || line > 2) return;
+  if (text.length() > controller_width) text = text.substr(0, controller_width);
+  text.append(controller_width - text.length(), ' ');
+
+  mutex.take();
+  desired[line] = text;
+  mutex.give();
+}
+
+void ControllerDisplay::clear_line(int line) { set_text(line, ""); }
+
+std::string ControllerDisplay::text_get(int line) {
+  if (line < 0 || line > 2) return "";
+  mutex.take();
+  std::string output = desired[line];
+  mutex.give();
+  return output;
+}
+
+void ControllerDisplay::rumble(std::string pattern) {
+  mutex.take();
+  rumble_pattern = pattern;
+  mutex.give();
+}
+
+// Send at most one change per interval, rumble first and then lines from top to bottom
+void ControllerDisplay::task_loop() {
+  while (true) {
+    pros::delay(update_interval);
+
+    // Whatever was on the controller is gone after it reconnects
+    bool connected = controller->is_connected();
+    mutex.take();
+    if (connected && !was_connected) {
+      for (auto& i : sent) i = "\n";
+    }
+    was_connected = connected;
+    if (!connected) {
+      mutex.give();
+      continue;
+    }
+
+    if (!rumble_pattern.empty()) {
+      std::string pattern = rumble_pattern;
+      rumble_pattern.clear();
+      mutex.give();
+      controller->rumble(pattern.c_str());
+      continue;
+    }
+
+    for (int i = 0; i < 3; i++) {
+      if (desired[i].empty() || desired[i] == sent[i]) continue;
+      std::string text = desired[i];
+      mutex.give();
+      bool success = controller->set_text(i, 0, text) == 1;  // A failed update is tried again next time
+      mutex.take();
+      if (success) sent[i] = text;
+      break;
+    }
+    mutex.give();
+  }
+}
@@ -0,0 +1,72 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/controller_input.hpp"
+
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+ControllerInput ez::master_input(&master);
+
+ControllerInput::ControllerInput(pros::Controller* input_controller)
+    : controller(input_controller) {}
+
+void ControllerInput::update() {
+  for (int i = 0; i < 4; i++)
+    axes[i] = controller->get_analog(static_cast<pros::controller_analog_e_t>(pros::E_CONTROLLER_ANALOG_LEFT_X + i));
+
+  for (int i = 0; i < 12; i++) {
+    last_buttons[i] = buttons[i];
+    buttons[i] = controller->get_digital(static_cast<pros::controller_digital_e_t>(pros::E_CONTROLLER_DIGITAL_L1 + i));
+  }
+
+  // The first snapshot has nothing to compare to, so nothing counts as a new press
+  if (!updated) {
+    for (int i = 0; i < 12; i++) last_buttons[i] = buttons[i];
+    updated = true;
+  }
+  last_update = pros::millis();
+}
+
+// True while update() is being called every loop.  Otherwise the snapshot is old and reads go to the controller
+bool ControllerInput::snapshot_active() { return updated && pros::millis() - last_update <= util::DELAY_TIME * 2; }
+
+// Buttons are L1 through A in the pros enum, anything else isn't a button
+int ControllerInput::button_index(pros::controller_digital_e_t button) {
+  int index = button - pros::E_CONTROLLER_DIGITAL_L1;
+  return index >= 0 && index < 12 ? index : -1;
+}
+
+int ControllerInput::analog(pros::controller_analog_e_t channel) {
+  if (!snapshot_active()) return controller->get_analog(channel);
+  int index = channel - pros::E_CONTROLLER_ANALOG_LEFT_X;
+  return index >= 0 && index < 4 ? axes[index] : 0;
+}
+
+bool ControllerInput::digital(pros::controller_digital_e_t button) {
+  if (!snapshot_active()) return controller->get_digital(button);
+  int index = button_index(button);
+  return index != -1 && buttons[index];
+}
+
+bool ControllerInput::digital_new_press(pros::controller_digital_e_t button) {
+  if (!snapshot_active()) return controller->get_digital_new_press(button);
+  int index = button_index(button);
+  return index != -1 && buttons[index] && !last_buttons[index];
+}
+
+bool ControllerInput::digital_new_release(pros::controller_digital_e_t button) {
+  int index = button_index(button);
+  if (index == -1) return false;
+  if (snapshot_active()) return !buttons[index] && last_buttons[index];
+
+  // pros doesn't have a new release, so each button remembers what it was the last time this was asked
+  bool held = controller->get_digital(button);
+  bool released = release_last[index] && !held;
+  release_last[index] = held;
+  return released;
+}
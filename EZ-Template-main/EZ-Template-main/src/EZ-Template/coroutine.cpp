@@ -0,0 +1,79 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/coroutine.hpp"
+
+using namespace ez;
+
+co::routine::routine(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+co::routine::routine(routine&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+co::routine& co::routine::operator=(routine&& other) noexcept {
+  if (this != &other) {
+    if (handle) handle.destroy();
+    handle = std::exchange(other.handle, nullptr);
+  }
+  return *this;
+}
+co::routine::~routine() {
+  if (handle) handle.destroy();
+}
+
+bool co::routine::done() { return !handle || handle.done(); }
+
+void co::routine::resume_if_ready() {
+  if (done()) return;
+
+  // Keep sleeping if what we're waiting on isn't ready yet
+  promise_type& promise = handle.promise();
+  if (promise.ready && !promise.ready()) return;
+
+  promise.ready = nullptr;
+  handle.resume();
+}
+
+// The caller checks on the inner routine every tick, and continues once it has returned
+void co::routine::await_suspend(std::coroutine_handle<promise_type> caller) {
+  caller.promise().ready = [this] {
+    resume_if_ready();
+    return done();
+  };
+}
+
+void co::motion_awaiter::await_suspend(std::coroutine_handle<routine::promise_type> caller) {
+  caller.promise().ready = [motion = motion]() mutable { return motion.done(); };
+}
+
+co::until_awaiter co::until(std::function<bool()> condition) { return {condition}; }
+
+co::until_awaiter co::delay(int time) {
+  std::uint32_t end = pros::millis() + time;
+  return {[end] { return pros::millis() >= end; }};
+}
+co::until_awaiter co::delay(okapi::QTime p_time) { return delay((int)p_time.convert(okapi::millisecond)); }
+
+// Suspends once, then resumes on the next pass through the scheduler
+co::until_awaiter co::next_tick() {
+  return {[waited = false]() mutable {
+    bool ready = waited;
+    waited = true;
+    return ready;
+  }};
+}
+
+void co::run(Drive& drive, std::vector<routine>& routines) {
+  while (true) {
+    // Resume anything whose awaited condition is ready
+    bool all_done = true;
+    for (auto& routine : routines) {
+      routine.resume_if_ready();
+      if (!routine.done()) all_done = false;
+    }
+    if (all_done) return;
+
+    // Sleep until the control loop finishes its next tick
+    drive.pid_tick_wait();
+  }
+}
@@ -0,0 +1,155 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <algorithm>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// V5 motors start cutting power at this temperature
+const double THROTTLE_TEMPERATURE = 55.0;
+const int BUDGET_PERIOD = 100;
+
+void Drive::drive_budget_set(bool toggle) {
+  budget_mutex.take();
+  budget_enabled = toggle;
+  budget_timer = 0;
+  if (toggle) {
+    budget_mutex.give();
+    return;
+  }
+
+  // Give everything the limit it had before the budget touched it.  Pto'd drive motors belong to the mechanism
+  // and are left alone, they get the drive's limit back when they return to the drive
+  std::uint32_t active = pto_active.load();
+  for (auto& motor : budget_motors) {
+    if (motor.limit_before < 0) continue;
+    if (motor.drive && (active & pto_bit(motor.port))) continue;
+    motor.limit = motor.limit_before;
+    motor.limit_before = -1;
+    pros::c::motor_set_current_limit(abs(motor.port), motor.limit);
+  }
+  budget_mutex.give();
+}
+bool Drive::drive_budget_get() { return budget_enabled; }
+
+void Drive::drive_budget_constants_set(int total_mA, double horizon, int drive_priority, int pto_priority) {
+  budget_total = abs(total_mA);
+  budget_horizon = fabs(horizon);
+  budget_drive_priority = abs(drive_priority);
+  budget_pto_priority = abs(pto_priority);
+}
+
+void Drive::drive_budget_motors_add(std::vector<pros::Motor> motors, int priority) {
+  budget_mutex.take();
+  for (auto& motor : motors) {
+    budget_motors.push_back({motor.get_port(), abs(priority), false});
+  }
+  budget_mutex.give();
+}
+
+std::vector<Drive::budget_motor> Drive::drive_budget_report_get() {
+  budget_mutex.take();
+  std::vector<budget_motor> output = budget_motors;
+  budget_mutex.give();
+  return output;
+}
+
+void Drive::budget_iterate() {
+  if (!budget_enabled) return;
+
+  budget_timer += util::DELAY_TIME;
+  if (budget_timer < BUDGET_PERIOD) return;
+  budget_timer = 0;
+
+  budget_mutex.take();
+  if (!budget_enabled) {
+    budget_mutex.give();
+    return;
+  }
+
+  // Drive motors are added the first time this runs
+  if (std::none_of(budget_motors.begin(), budget_motors.end(), [](const budget_motor& motor) { return motor.drive; })) {
+    for (auto& motor : left_motors) budget_motors.push_back({motor.get_port(), budget_drive_priority, true});
+    for (auto& motor : right_motors) budget_motors.push_back({motor.get_port(), budget_drive_priority, true});
+  }
+
+  // Predict how long each motor has until it throttles, and weigh it by priority
+  double dt = BUDGET_PERIOD / 1000.0;
+  std::vector<double> weights;
+  weights.reserve(budget_motors.size());
+  for (auto& motor : budget_motors) {
+    double temperature = pros::c::motor_get_temperature(abs(motor.port));
+
+    // Temperature is only reported in 5 degree steps, so heating is the size of the last step over how long it took.
+    // Between steps it can only be as fast as the next step coming right now
+    motor.step_time += dt;
+    if (temperature != motor.temperature) {
+      if (motor.temperature != 0.0) {
+        motor.step_size = temperature - motor.temperature;
+        motor.heating = motor.step_size / motor.step_time;
+      }
+      motor.step_time = 0.0;
+      motor.temperature = temperature;
+    } else if (motor.heating > 0.0) {
+      motor.heating = fmin(motor.heating, motor.step_size / motor.step_time);
+    }
+
+    if (motor.temperature >= THROTTLE_TEMPERATURE)
+      motor.time_to_throttle = 0.0;
+    else if (motor.heating > 0.0)
+      motor.time_to_throttle = (THROTTLE_TEMPERATURE - motor.temperature) / motor.heating;
+    else
+      motor.time_to_throttle = 1e9;
+
+    // Drive motors that are pto'd are treated as part of the mechanism
+    int priority = motor.drive ? budget_drive_priority : motor.priority;
+    if (motor.drive && (pto_active.load() & pto_bit(motor.port))) priority = budget_pto_priority;
+
+    // Motors that would throttle before the horizon get less current so they heat slower
+    weights.push_back(priority * util::clamp(budget_horizon == 0.0 ? 1.0 : motor.time_to_throttle / budget_horizon, 1.0, 0.25));
+  }
+
+  // Water fill the budget.  Motors whose share is over their max get their max, and what they couldn't use is split
+  // between the rest by weight until nobody is over
+  std::vector<double> shares(budget_motors.size(), 0.0);
+  std::vector<bool> capped(budget_motors.size(), false);
+  double remaining = budget_total;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    double total_weight = 0.0;
+    for (int i = 0; i < (int)budget_motors.size(); i++)
+      if (!capped[i]) total_weight += weights[i];
+    if (total_weight == 0.0) break;
+
+    for (int i = 0; i < (int)budget_motors.size(); i++) {
+      if (capped[i]) continue;
+      double max = budget_motors[i].drive ? CURRENT_MA : 2500;
+      shares[i] = remaining * weights[i] / total_weight;
+      if (shares[i] >= max) {
+        shares[i] = max;
+        capped[i] = true;
+        remaining -= max;
+        changed = true;
+      }
+    }
+  }
+
+  // Only send new limits when they change enough to matter
+  for (int i = 0; i < (int)budget_motors.size(); i++) {
+    budget_motor& motor = budget_motors[i];
+    int limit = (int)shares[i];
+    if (abs(limit - motor.limit) < 50) continue;
+    if (motor.limit_before < 0) motor.limit_before = pros::c::motor_get_current_limit(abs(motor.port));
+    motor.limit = limit;
+    pros::c::motor_set_current_limit(abs(motor.port), limit);
+  }
+
+  budget_mutex.give();
+}
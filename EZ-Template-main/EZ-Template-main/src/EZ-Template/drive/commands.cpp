@@ -0,0 +1,93 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// True when called from ez_auto_task, ie from a trigger callback or a pid_*_set calling another one
+bool Drive::command_on_task() { return pros::c::task_get_current() == static_cast<pros::task_t>(ez_auto); }
+
+// Publish a motion for ez_auto_task to start on its next tick.  The id is picked now so the handle can be waited on right away
+motion_handle Drive::motion_command(std::function<void()> apply) {
+  if (command_on_task()) {
+    apply();
+    return motion_handle(this, motion_id);
+  }
+
+  std::uint32_t id = ++motion_issued;
+  command_issued = id;
+  delete command_pending.exchange(new command_{id, apply});  // Anything still pending was replaced before it started
+  return motion_handle(this, id);
+}
+
+// Change the running motion from ez_auto_task.  A motion that's already waiting to start wins over the adjustment
+void Drive::motion_adjust(std::function<void()> apply) {
+  if (command_on_task()) {
+    apply();
+    return;
+  }
+
+  command_* command = new command_{motion_issued.load(), apply, true};
+  command_* expected = nullptr;
+  if (!command_pending.compare_exchange_strong(expected, command)) delete command;
+}
+
+// Change a setting ez_auto_task reads while it runs.  Unlike motions these queue up, so none of them are replaced
+void Drive::motion_config(std::function<void()> apply) {
+  if (command_on_task()) {
+    apply();
+    return;
+  }
+
+  config_mutex.take();
+  config_pending.push_back(apply);
+  config_mutex.give();
+}
+
+// Start the newest command, this runs at the start of every tick in ez_auto_task
+void Drive::command_iterate() {
+  // Settings go first, so a motion published after them starts with them
+  std::vector<std::function<void()>> configs;
+  config_mutex.take();
+  configs.swap(config_pending);
+  config_mutex.give();
+  for (auto& apply : configs) apply();
+
+  command_* command = command_pending.exchange(nullptr);
+  if (command == nullptr) return;
+
+  if (command->adjust) {
+    if (command->id == motion_id) command->apply();
+    delete command;
+    return;
+  }
+
+  // Skip it if a motion was started directly on this task after the command was published
+  if (command->id > motion_id) {
+    command_id = command->id;
+    command->apply();
+    command_id = 0;
+  }
+  command_applied = command->id;
+  delete command;
+}
+
+// Throw away a command that hasn't started, this is used when the drive is set directly
+void Drive::command_drop() {
+  command_* command = command_pending.exchange(nullptr);
+  if (command == nullptr) return;
+  if (!command->adjust) command_applied = command->id;
+  delete command;
+}
+
+// Block until ez_auto_task has started the last command, so mode and targets are up to date for this task
+void Drive::motion_command_wait() {
+  if (command_on_task()) return;
+  while (command_applied.load() < command_issued.load())
+    pid_tick_wait();
+}
@@ -201,9 +201,7 @@ void Drive::alignToSideWall(double target_in, int timeout_ms) {
     double errWall = sideIn - target_in;   // Nicole!!! Note it may need to be reversed if the direction is reversed!!!
 
     // --- heading error ---
-    double errHead = holdHeading - drive_imu_get(); // Nicole!!! Note it may need to be reversed if the direction is reversed!!!
-    while (errHead > 180) errHead -= 360;
-    while (errHead < -180) errHead += 360;
+    double errHead = ez::util::wrap_angle(holdHeading - drive_imu_get()); // Nicole!!! Note it may need to be reversed if the direction is reversed!!!
 
     if (std::fabs(errWall) < stopBand) stable++;
     else stable = 0;
@@ -281,9 +279,7 @@ void Drive::drive_follow_sidewall(double forward_in,
     // --- 4) heading error (degrees) ---
     double h = drive_imu_get(); // current IMU reading
     double errHead = hold_heading_deg - h; //Nicole!!! Note it may need to be reversed if the direction is reversed!!!
-    // wrap to [-180, 180]
-    while (errHead > 180) errHead -= 360;
-    while (errHead < -180) errHead += 360;
+    errHead = ez::util::wrap_angle(errHead);  // wrap to [-180, 180]
 
     // --- 5) heading adjustment ---
     // steer > 0 will let the robot turn right (left-right difference)
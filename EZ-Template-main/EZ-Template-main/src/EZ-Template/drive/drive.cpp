@@ -163,6 +163,8 @@ void Drive::drive_defaults_set() {
   pid_odom_boomerang_constants_set(5.8, 0.0, 32.5);
   pid_turn_min_set(30);
   pid_swing_min_set(30);
+  pid_drive_velocity_constants_set(1.0, 0.0, 0.0);
+  drive_slip_constants_set(15.0, 0.8, 10.0, 40.0);
 
   // Path Constants
   odom_path_smooth_constants_set(0.75, 0.03, 0.0001);
@@ -193,6 +195,7 @@ void Drive::drive_defaults_set() {
 
   // Modify joystick curve on controller (defaults to disabled)
   opcontrol_curve_buttons_toggle(true);
+  curve_tables_build();
 
   // Left / Right modify buttons
   opcontrol_curve_buttons_left_set(pros::E_CONTROLLER_DIGITAL_LEFT, pros::E_CONTROLLER_DIGITAL_RIGHT);
@@ -226,25 +229,77 @@ double Drive::drive_ratio_get() { return RATIO; }
 void Drive::drive_rpm_set(double rpm) { CARTRIDGE = rpm; }
 double Drive::drive_rpm_get() { return CARTRIDGE; }
 
-void Drive::private_drive_set(int left, int right) {
-  if (pros::millis() < 1500) return;
+void Drive::private_drive_set(int left, int right, int strafe) {
+  if (initialize_running) return;
 
-  for (auto i : left_motors) {
-    if (!pto_check(i)) i.move_voltage(left * (12000.0 / 127.0));  // If the motor is in the pto list, don't do anything to the motor.
+  // Scale everything down together so a holonomic drive keeps its direction when a wheel would go over 127
+  if (!holonomic) strafe = 0;
+  double fastest = fmax(abs(left), abs(right)) + abs(strafe);
+  if (strafe != 0 && fastest > 127.0) {
+    left *= 127.0 / fastest;
+    right *= 127.0 / fastest;
+    strafe *= 127.0 / fastest;
   }
-  for (auto i : right_motors) {
-    if (!pto_check(i)) i.move_voltage(right * (12000.0 / 127.0));  // If the motor is in the pto list, don't do anything to the motor.
+
+  // Limit each side while it's slipping
+  if (slip_enabled) {
+    left = util::clamp(left, traction_limit_left);
+    right = util::clamp(right, traction_limit_right);
+    traction_last_left = left;
+    traction_last_right = right;
+  }
+
+  // Scale to the nominal battery voltage so output doesn't change as the battery drains
+  double scale = 12000.0 / 127.0;
+  if (battery_compensation && battery_filtered > 0.0)
+    scale *= battery_nominal / battery_filtered;
+  int left_mV = util::clamp(left * scale, 12000.0);
+  int right_mV = util::clamp(right * scale, 12000.0);
+  int strafe_mV = util::clamp(strafe * scale, 12000.0);
+
+  // Motors that are about to be pto'd are ramped down
+  std::uint32_t active = pto_active.load();
+  std::uint32_t ramping = pto_ramping.load();
+  double ramp = pto_ramp_time == 0 ? 0.0 : util::clamp(1.0 - ((double)pto_ramp_timer.load() / pto_ramp_time), 1.0, 0.0);
+
+  // Front wheels strafe right by spinning out on the left and in on the right, back wheels do the opposite
+  for (int j = 0; j < left_motors.size(); j++) {
+    pros::Motor& i = left_motors[j];
+    std::uint32_t bit = pto_bit(i.get_port());
+    if (active & bit) continue;  // If the motor is in the pto list, don't do anything to the motor.
+    int mV = util::clamp(left_mV + (j < left_motors.size() / 2 ? strafe_mV : -strafe_mV), 12000.0);
+    i.move_voltage(ramping & bit ? mV * ramp : mV);
+  }
+  for (int j = 0; j < right_motors.size(); j++) {
+    pros::Motor& i = right_motors[j];
+    std::uint32_t bit = pto_bit(i.get_port());
+    if (active & bit) continue;  // If the motor is in the pto list, don't do anything to the motor.
+    int mV = util::clamp(right_mV + (j < right_motors.size() / 2 ? -strafe_mV : strafe_mV), 12000.0);
+    i.move_voltage(ramping & bit ? mV * ramp : mV);
   }
 }
 
+void Drive::drive_battery_compensation_set(bool toggle) { battery_compensation = toggle; }
+bool Drive::drive_battery_compensation_get() { return battery_compensation; }
+void Drive::drive_battery_nominal_set(double volts) { battery_nominal = fabs(volts); }
+double Drive::drive_battery_nominal_get() { return battery_nominal; }
+double Drive::drive_battery_get() { return battery_filtered; }
+
+// Low pass the battery so a current spike doesn't change output for a single tick
+void Drive::battery_iterate() {
+  double current = pros::battery::get_voltage() / 1000.0;
+  if (current <= 0.0) return;
+  battery_filtered = battery_filtered == 0.0 ? current : battery_filtered + ((current - battery_filtered) * 0.05);
+}
+
 void Drive::drive_set(int left, int right) {
   drive_mode_set(DISABLE, false);
   private_drive_set(left, right);
 }
 
 std::vector<int> Drive::drive_get() {
-  int left = left_motors[0].get_voltage() / (12000.0 / 127.0);
-  int right = right_motors[0].get_voltage() / (12000.0 / 127.0);
+  int left = side_motor_get(left_motors, sensor_left).get_voltage() / (12000.0 / 127.0);
+  int right = side_motor_get(right_motors, sensor_right).get_voltage() / (12000.0 / 127.0);
   return {left, right};
 }
 
@@ -278,8 +333,7 @@ void Drive::drive_sensor_reset() {
   t_last = 0.0;
 
   // Reset sensors
-  left_motors.front().tare_position();
-  right_motors.front().tare_position();
+  sensors_reset();
   if (odom_tracker_left_enabled) odom_tracker_left->reset();
   if (odom_tracker_right_enabled) odom_tracker_right->reset();
   if (odom_tracker_front_enabled) odom_tracker_front->reset();
@@ -302,16 +356,21 @@ int Drive::drive_sensor_right_raw() {
     return right_rotation.get_position();
   else if (is_tracker == ODOM_TRACKER)
     return odom_tracker_right->get_raw();
-  return right_motors.front().get_position();
+  return sensor_right.position.load();
 }
 double Drive::drive_sensor_right() {
   if (is_tracker == ODOM_TRACKER)
     return odom_tracker_right->get();
   return drive_sensor_right_raw() / drive_tick_per_inch();
 }
-int Drive::drive_velocity_right() { return right_motors.front().get_actual_velocity(); }
-double Drive::drive_mA_right() { return right_motors.front().get_current_draw(); }
-bool Drive::drive_current_right_over() { return right_motors.front().is_over_current(); }
+int Drive::drive_velocity_right() { return side_motor_get(right_motors, sensor_right).get_actual_velocity(); }
+double Drive::drive_mA_right() { return side_motor_get(right_motors, sensor_right).get_current_draw(); }
+bool Drive::drive_current_right_over() {
+  std::uint32_t skip = sensor_right.failed.load() | pto_active.load();
+  for (auto& i : right_motors)
+    if (!(skip & pto_bit(i.get_port())) && i.is_over_current()) return true;
+  return false;
+}
 
 int Drive::drive_sensor_left_raw() {
   if (is_tracker == DRIVE_ADI_ENCODER)
@@ -320,24 +379,43 @@ int Drive::drive_sensor_left_raw() {
     return left_rotation.get_position();
   else if (is_tracker == ODOM_TRACKER)
     return odom_tracker_left->get_raw();
-  return left_motors.front().get_position();
+  return sensor_left.position.load();
 }
 double Drive::drive_sensor_left() {
   if (is_tracker == ODOM_TRACKER)
     return odom_tracker_left->get();
   return drive_sensor_left_raw() / drive_tick_per_inch();
 }
-int Drive::drive_velocity_left() { return left_motors.front().get_actual_velocity(); }
-double Drive::drive_mA_left() { return left_motors.front().get_current_draw(); }
-bool Drive::drive_current_left_over() { return left_motors.front().is_over_current(); }
+int Drive::drive_velocity_left() { return side_motor_get(left_motors, sensor_left).get_actual_velocity(); }
+double Drive::drive_mA_left() { return side_motor_get(left_motors, sensor_left).get_current_draw(); }
+bool Drive::drive_current_left_over() {
+  std::uint32_t skip = sensor_left.failed.load() | pto_active.load();
+  for (auto& i : left_motors)
+    if (!(skip & pto_bit(i.get_port())) && i.is_over_current()) return true;
+  return false;
+}
 
 void Drive::drive_imu_reset(double new_heading) {
-  imu.set_rotation(new_heading);
+  // The fused heading belongs to ez_auto_task, so with two imus the reset waits for the start of its next tick
+  if (imu_secondary_port.load() != 0 && !command_on_task()) {
+    imu_reset_heading = new_heading;
+    while (!std::isnan(imu_reset_heading.load()))
+      pid_tick_wait();
+  } else {
+    imu_reset_apply(new_heading);
+  }
   angle_rad = util::to_rad(new_heading);
   t_last = angle_rad;
 }
-double Drive::drive_imu_get() { return imu.get_rotation() * IMU_SCALER; }
-double Drive::drive_imu_accel_get() { return imu.get_accel().x + imu.get_accel().y; }
+double Drive::drive_imu_get() {
+  if (imu_secondary_port.load() != 0) return imu_fused.load() * IMU_SCALER;
+  return imu.get_rotation() * IMU_SCALER;
+}
+double Drive::drive_imu_accel_get() {
+  // ez_auto_task shares one reading per tick, other tasks read the imu themselves
+  pros::imu_accel_s_t accel = command_on_task() ? imu_accel_tick() : imu.get_accel();
+  return accel.x + accel.y;
+}
 
 void Drive::drive_imu_scaler_set(double scaler) { IMU_SCALER = scaler; }
 double Drive::drive_imu_scaler_get() { return IMU_SCALER; }
@@ -376,8 +454,13 @@ void Drive::drive_imu_display_loading(int iter) {
 bool Drive::drive_imu_calibrate(bool run_loading_animation) {
   imu_calibration_complete = false;
   imu.reset();
+  // This runs outside ez_auto_task, so the secondary imu is reached through its own handle on the same port
+  std::optional<pros::Imu> imu_other;
+  if (imu_secondary_port.load() != 0) imu_other.emplace(imu_secondary_port.load());
+  bool secondary = imu_other && imu_other->is_installed();
+  if (secondary) imu_other->reset();
   int iter = 0;
-  bool current_status = imu.is_calibrating();
+  bool current_status = imu.is_calibrating() || (secondary && imu_other->is_calibrating());
   bool last_status = current_status;
   bool successful = false;
   while (true) {
@@ -387,7 +470,7 @@ bool Drive::drive_imu_calibrate(bool run_loading_animation) {
 
     if (!successful) {
       last_status = current_status;
-      current_status = imu.is_calibrating();
+      current_status = imu.is_calibrating() || (secondary && imu_other->is_calibrating());
       successful = !current_status && last_status ? true : false;
     }
 
@@ -432,11 +515,30 @@ pros::motor_brake_mode_e_t Drive::drive_brake_get() {
 }
 
 void Drive::initialize() {
-  opcontrol_curve_sd_initialize();
-  drive_imu_calibrate();
-  drive_sensor_reset();
   // Nicole!!! Initializes distance sensors if they are set
   distance_sensor_init(&front, &side);
+
+  // Everything slow happens in the background so initialize() returns right away.  The drive can't move until it's done
+  if (initialize_running) return;
+  initialize_running = true;
+  initialize_done = false;
+  pros::Task([this]() {
+    opcontrol_curve_sd_initialize();
+    drive_imu_scaler_sd_initialize();
+    drive_odom_calibration_sd_initialize();
+    drive_imu_calibrate();
+    drive_sensor_reset();
+    initialize_done = true;
+    initialize_running = false;
+  });
+}
+
+bool Drive::drive_initialized() { return initialize_done; }
+
+bool Drive::drive_initialize_wait() {
+  while (initialize_running)
+    pros::delay(util::DELAY_TIME);
+  return drive_imu_calibrated();
 }
 
 void Drive::odom_tracker_left_set(tracking_wheel* input) {
@@ -452,6 +554,8 @@ void Drive::odom_tracker_left_set(tracking_wheel* input) {
   // the tracking wheels become the new sensors always
   if (odom_tracker_right_enabled)
     is_tracker = ODOM_TRACKER;
+
+  odom_calibration_apply();  // Calibrated geometry wins over what was set in code
 }
 void Drive::odom_tracker_right_set(tracking_wheel* input) {
   if (input == nullptr) return;
@@ -463,12 +567,16 @@ void Drive::odom_tracker_right_set(tracking_wheel* input) {
   // the tracking wheels become the new sensors always
   if (odom_tracker_left_enabled)
     is_tracker = ODOM_TRACKER;
+
+  odom_calibration_apply();  // Calibrated geometry wins over what was set in code
 }
 void Drive::odom_tracker_front_set(tracking_wheel* input) {
   if (input == nullptr) return;
 
   odom_tracker_front = input;
   odom_tracker_front_enabled = true;
+
+  odom_calibration_apply();  // Calibrated geometry wins over what was set in code
 }
 void Drive::odom_tracker_back_set(tracking_wheel* input) {
   if (input == nullptr) return;
@@ -478,4 +586,6 @@ void Drive::odom_tracker_back_set(tracking_wheel* input) {
 
   // Set the center distance to be negative
   odom_tracker_back->distance_to_center_flip_set(true);
+
+  odom_calibration_apply();  // Calibrated geometry wins over what was set in code
 }
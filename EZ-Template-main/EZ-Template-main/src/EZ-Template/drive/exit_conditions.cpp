@@ -98,149 +98,179 @@ void Drive::pid_odom_turn_exit_condition_set(okapi::QTime p_small_exit_time, oka
   pid_odom_turn_exit_condition_set(set, se, bet, be, vet, mAt, use_imu);
 }
 
-// User wrapper for exit condition
-void Drive::pid_wait() {
-  // Let the PID run at least 1 iteration
-  pros::delay(util::DELAY_TIME);
+// Returns a handle to the most recent motion, including one that ez_auto_task hasn't started yet
+motion_handle Drive::pid_motion_get() { return motion_handle(this, command_on_task() ? motion_id : motion_issued.load()); }
+
+// Every new motion gets a new id, anything still running was replaced by it
+void Drive::motion_start() {
+  motion_primary_exit = RUNNING;
+  motion_secondary_exit = RUNNING;
+
+  // A command keeps its id when it changes modes while starting, ie turn to point starts as a turn
+  if (command_id != 0 && command_id == motion_id) return;
+  motion_finish(motion_id, CANCEL_EXIT);
+
+  // Commands picked their id when they were published, and any commands they replaced never ran
+  std::uint32_t id = command_id != 0 ? command_id : ++motion_issued;
+  for (std::uint32_t skipped = id - 1; skipped > motion_id && id - skipped < motion_results.size(); skipped--)
+    motion_results[skipped % motion_results.size()] = CANCEL_EXIT;
+  motion_results[id % motion_results.size()] = RUNNING;
+  motion_id = id;
+}
 
-  if (mode == DRIVE) {
-    exit_output left_exit = RUNNING;
-    exit_output right_exit = RUNNING;
-    while (left_exit == RUNNING || right_exit == RUNNING) {
-      leftPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      rightPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      left_exit = left_exit != RUNNING ? left_exit : leftPID.exit_condition(left_motors[0]);
-      right_exit = right_exit != RUNNING ? right_exit : rightPID.exit_condition(right_motors[0]);
-      pros::delay(util::DELAY_TIME);
-    }
-    if (print_toggle) std::cout << "  Left: " << exit_to_string(left_exit) << " Exit, error: " << leftPID.error << "   Right: " << exit_to_string(right_exit) << " Exit, error: " << rightPID.error << "\n";
+// Store why a motion exited and wake anything waiting on it
+void Drive::motion_finish(std::uint32_t id, exit_output reason) {
+  if (motion_exit_get(id) != RUNNING) return;
+  motion_results[id % motion_results.size()] = reason;
 
-    if (left_exit == mA_EXIT || left_exit == VELOCITY_EXIT || right_exit == mA_EXIT || right_exit == VELOCITY_EXIT) {
-      interfered = true;
-    }
+  if (reason == mA_EXIT || reason == VELOCITY_EXIT) {
+    interfered = true;
   }
+  motion_waiters_notify();
+}
 
-  // Odom Exits
-  else if (mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
-    exit_output xy_exit = RUNNING;
-    exit_output a_exit = RUNNING;
-
-    // Wait until pure pursuit is on the last point, then continue as normal
-    if (mode == PURE_PURSUIT) {
-      while (pp_index != pp_movements.size() - 1) {
-        xyPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-        current_a_odomPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-        xy_exit = xy_exit != RUNNING ? xy_exit : xyPID.exit_condition({left_motors[0], right_motors[0]});
-        a_exit = a_exit != RUNNING ? a_exit : current_a_odomPID.exit_condition({left_motors[0], right_motors[0]});
-
-        if ((xy_exit == mA_EXIT || xy_exit == VELOCITY_EXIT) && (a_exit == mA_EXIT || a_exit == VELOCITY_EXIT)) {
-          if (print_toggle) std::cout << "  XY: " << exit_to_string(xy_exit) << " Exited early, error: " << xyPID.error << ".   Angle: " << exit_to_string(a_exit) << " Exited early, error: " << current_a_odomPID.error << ".\n";
-          break;
-        }
-
-        pros::delay(util::DELAY_TIME);
-      }
-    }
+// Motions that never existed, or are too old to be remembered, are treated as cancelled
+exit_output Drive::motion_exit_get(std::uint32_t id) {
+  // Published commands are running, they just haven't been started by ez_auto_task yet
+  if (id > motion_id && id > command_applied.load() && id <= motion_issued.load()) return RUNNING;
+  if (id == 0 || id > motion_id || motion_id - id >= motion_results.size()) return CANCEL_EXIT;
+  return motion_results[id % motion_results.size()];
+}
 
-    // When we're at the last point in PP / we're just going to point
-    while (xy_exit == RUNNING || a_exit == RUNNING) {
-      xyPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      current_a_odomPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      xy_exit = xy_exit != RUNNING ? xy_exit : xyPID.exit_condition({left_motors[0], right_motors[0]});
-      a_exit = a_exit != RUNNING ? a_exit : current_a_odomPID.exit_condition({left_motors[0], right_motors[0]});
-      pros::delay(util::DELAY_TIME);
-    }
-    if (print_toggle) std::cout << "  XY: " << exit_to_string(xy_exit) << " Exit, error: " << xyPID.error << ".   Angle: " << exit_to_string(a_exit) << " Exit, error: " << current_a_odomPID.error << ".\n";
+// Tasks waiting on a motion register here so ez_auto_task can notify them
+bool Drive::motion_waiter_add(pros::task_t task) {
+  for (auto& waiter : motion_waiters) {
+    pros::task_t empty = nullptr;
+    if (waiter.compare_exchange_strong(empty, task)) return true;
+  }
+  return false;
+}
+void Drive::motion_waiter_remove(pros::task_t task) {
+  for (auto& waiter : motion_waiters) {
+    pros::task_t current = task;
+    waiter.compare_exchange_strong(current, nullptr);
+  }
+}
+void Drive::motion_waiters_notify() {
+  for (auto& waiter : motion_waiters) {
+    pros::task_t task = waiter.load();
+    if (task != nullptr) pros::c::task_notify(task);
+  }
+}
 
-    if (xy_exit == mA_EXIT || xy_exit == VELOCITY_EXIT || a_exit == mA_EXIT || a_exit == VELOCITY_EXIT) {
-      interfered = true;
+// Sleep until ez_auto_task finishes a tick.  The timeout only matters if there were no free waiter slots
+void Drive::motion_tick_wait() { pros::c::task_notify_take(true, util::DELAY_TIME * 2); }
+
+// Public version of motion_tick_wait, for anything that wants to run in step with the control loop
+void Drive::pid_tick_wait() {
+  pros::task_t self = pros::c::task_get_current();
+  bool registered = motion_waiter_add(self);
+  motion_tick_wait();
+  if (registered) motion_waiter_remove(self);
+}
+
+// Computes exit conditions for the running motion, this runs once per tick in ez_auto_task right after the PID update
+void Drive::exit_conditions_iterate() {
+  std::uint32_t id = motion_id;
+  if (mode == DISABLE || motion_exit_get(id) != RUNNING) return;
+
+  // Every sensor the exits need is read once per tick, and only if an exit uses it
+  auto accel_needed = [](PID& pid) { return pid.velocity_sensor_secondary_toggle_get() && pid.exit.velocity_exit_time != 0; };
+  auto mA_needed = [](PID& pid) { return pid.exit.mA_timeout != 0; };
+  double accel = 0.0;
+
+  // Drive Exit
+  if (mode == DRIVE) {
+    if (accel_needed(leftPID) || accel_needed(rightPID)) accel = drive_imu_accel_get();
+    bool left_mA = mA_needed(leftPID) && drive_current_left_over();
+    bool right_mA = mA_needed(rightPID) && drive_current_right_over();
+
+    leftPID.velocity_sensor_secondary_set(accel);
+    rightPID.velocity_sensor_secondary_set(accel);
+    motion_primary_exit = motion_primary_exit != RUNNING ? motion_primary_exit : leftPID.exit_condition_mA(left_mA);
+    motion_secondary_exit = motion_secondary_exit != RUNNING ? motion_secondary_exit : rightPID.exit_condition_mA(right_mA);
+  }
+
+  // Odom Exits
+  else if (mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
+    if (accel_needed(xyPID) || accel_needed(current_a_odomPID)) accel = drive_imu_accel_get();
+    bool over_current = (mA_needed(xyPID) || mA_needed(current_a_odomPID)) && (drive_current_left_over() || drive_current_right_over());
+
+    xyPID.velocity_sensor_secondary_set(accel);
+    current_a_odomPID.velocity_sensor_secondary_set(accel);
+    motion_primary_exit = motion_primary_exit != RUNNING ? motion_primary_exit : xyPID.exit_condition_mA(over_current);
+    motion_secondary_exit = motion_secondary_exit != RUNNING ? motion_secondary_exit : current_a_odomPID.exit_condition_mA(over_current);
+
+    // Pure pursuit only settles on the last point, unless both exits were interfered with before getting there
+    if (mode == PURE_PURSUIT && pp_index != pp_movements.size() - 1) {
+      if (motion_primary_exit != mA_EXIT && motion_primary_exit != VELOCITY_EXIT) motion_primary_exit = RUNNING;
+      if (motion_secondary_exit != mA_EXIT && motion_secondary_exit != VELOCITY_EXIT) motion_secondary_exit = RUNNING;
     }
   }
 
   // Turn Exit
   else if (mode == TURN || mode == TURN_TO_POINT) {
-    exit_output turn_exit = RUNNING;
-    while (turn_exit == RUNNING) {
-      turnPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      turn_exit = turn_exit != RUNNING ? turn_exit : turnPID.exit_condition({left_motors[0], right_motors[0]});
-      pros::delay(util::DELAY_TIME);
-    }
-    if (print_toggle) std::cout << "  Turn: " << exit_to_string(turn_exit) << " Exit, error: " << turnPID.error << "\n";
+    if (accel_needed(turnPID)) accel = drive_imu_accel_get();
+    bool over_current = mA_needed(turnPID) && (drive_current_left_over() || drive_current_right_over());
 
-    if (turn_exit == mA_EXIT || turn_exit == VELOCITY_EXIT) {
-      interfered = true;
-    }
+    turnPID.velocity_sensor_secondary_set(accel);
+    motion_primary_exit = motion_primary_exit != RUNNING ? motion_primary_exit : turnPID.exit_condition_mA(over_current);
+    motion_secondary_exit = motion_primary_exit;
   }
 
   // Swing Exit
   else if (mode == SWING) {
-    exit_output swing_exit = RUNNING;
-    pros::Motor& sensor = current_swing == ez::LEFT_SWING ? left_motors[0] : right_motors[0];
-    while (swing_exit == RUNNING) {
-      swingPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-      swing_exit = swing_exit != RUNNING ? swing_exit : swingPID.exit_condition(sensor);
-      pros::delay(util::DELAY_TIME);
-    }
-    if (print_toggle) std::cout << "  Swing: " << exit_to_string(swing_exit) << " Exit, error: " << swingPID.error << "\n";
+    if (accel_needed(swingPID)) accel = drive_imu_accel_get();
+    bool over_current = mA_needed(swingPID) && (current_swing == ez::LEFT_SWING ? drive_current_left_over() : drive_current_right_over());
 
-    if (swing_exit == mA_EXIT || swing_exit == VELOCITY_EXIT) {
-      interfered = true;
-    }
+    swingPID.velocity_sensor_secondary_set(accel);
+    motion_primary_exit = motion_primary_exit != RUNNING ? motion_primary_exit : swingPID.exit_condition_mA(over_current);
+    motion_secondary_exit = motion_primary_exit;
   }
+
+  // The motion is only as settled as its least settled PID
+  if (motion_primary_exit != RUNNING && motion_secondary_exit != RUNNING)
+    motion_finish(id, std::max(motion_primary_exit, motion_secondary_exit));
 }
 
-void Drive::wait_until_drive(double target) {
-  pros::delay(10);
+// User wrapper for exit condition
+void Drive::pid_wait() {
+  motion_command_wait();
+  e_mode waited_mode = mode;
+  if (waited_mode == DISABLE) return;
+
+  pid_motion_get().wait();
+  if (!print_toggle) return;
+
+  if (waited_mode == DRIVE) {
+    std::cout << "  Left: " << exit_to_string(motion_primary_exit) << " Exit, error: " << leftPID.error << "   Right: " << exit_to_string(motion_secondary_exit) << " Exit, error: " << rightPID.error << "\n";
+  } else if (waited_mode == POINT_TO_POINT || waited_mode == PURE_PURSUIT) {
+    std::cout << "  XY: " << exit_to_string(motion_primary_exit) << " Exit, error: " << xyPID.error << ".   Angle: " << exit_to_string(motion_secondary_exit) << " Exit, error: " << current_a_odomPID.error << ".\n";
+  } else if (waited_mode == TURN || waited_mode == TURN_TO_POINT) {
+    std::cout << "  Turn: " << exit_to_string(motion_primary_exit) << " Exit, error: " << turnPID.error << "\n";
+  } else if (waited_mode == SWING) {
+    std::cout << "  Swing: " << exit_to_string(motion_primary_exit) << " Exit, error: " << swingPID.error << "\n";
+  }
+  printf("  Battery: %.2fV\n", drive_battery_get());
+}
 
+void Drive::wait_until_drive(double target) {
   // Make sure mode is correct
   if (!(mode == DRIVE || mode == POINT_TO_POINT || mode == PURE_PURSUIT)) {
     printf("Mode needs to be drive!\n");
     return;
   }
 
-  // Calculate error between current and target (target needs to be an in between position)
+  // Target needs to be an in between position
   double l_tar = l_start + target;
   double r_tar = r_start + target;
-  double l_error = l_tar - drive_sensor_left();
-  double r_error = r_tar - drive_sensor_right();
-  int l_sgn = util::sgn(l_error);
-  int r_sgn = util::sgn(r_error);
-
-  exit_output left_exit = RUNNING;
-  exit_output right_exit = RUNNING;
-
-  while (true) {
-    l_error = l_tar - drive_sensor_left();
-    r_error = r_tar - drive_sensor_right();
-
-    // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
-    if (util::sgn(l_error) == l_sgn || util::sgn(r_error) == r_sgn) {
-      if (left_exit == RUNNING || right_exit == RUNNING) {
-        leftPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-        rightPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-        left_exit = left_exit != RUNNING ? left_exit : leftPID.exit_condition(left_motors[0]);
-        right_exit = right_exit != RUNNING ? right_exit : rightPID.exit_condition(right_motors[0]);
-        pros::delay(util::DELAY_TIME);
-      } else {
-        if (print_toggle) {
-          std::cout << "  Left: " << exit_to_string(left_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_left() - l_start << " instead of " << l_tar << "\n";
-          std::cout << "  Right: " << exit_to_string(right_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_right() - r_start << " instead of " << r_tar << "\n";
-        }
-        if (left_exit == mA_EXIT || left_exit == VELOCITY_EXIT || right_exit == mA_EXIT || right_exit == VELOCITY_EXIT) {
-          interfered = true;
-        }
-        return;
-      }
-    }
-    // Once we've past target, return
-    else if (util::sgn(l_error) != l_sgn || util::sgn(r_error) != r_sgn) {
-      if (print_toggle) printf("  Drive Wait Until Exit Success. Triggered at: L,R(%.2f, %.2f)  Target: L,R(%.2f, %.2f)\n", drive_sensor_left() - l_start, drive_sensor_right() - r_start, l_tar, r_tar);
-      leftPID.timers_reset();
-      rightPID.timers_reset();
-      return;
-    }
 
-    pros::delay(util::DELAY_TIME);
+  // ez_auto_task checks the target and the exit conditions, this task sleeps until one of them happens
+  if (pid_motion_get().wait_until(target)) {
+    if (print_toggle) printf("  Drive Wait Until Exit Success. Triggered at: L,R(%.2f, %.2f)  Target: L,R(%.2f, %.2f)\n", drive_sensor_left() - l_start, drive_sensor_right() - r_start, l_tar, r_tar);
+  } else if (print_toggle) {
+    std::cout << "  Left: " << exit_to_string(motion_primary_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_left() - l_start << " instead of " << l_tar << "\n";
+    std::cout << "  Right: " << exit_to_string(motion_secondary_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_right() - r_start << " instead of " << r_tar << "\n";
   }
 }
 
@@ -252,76 +282,21 @@ void Drive::wait_until_turn_swing(double target) {
     return;
   }
 
-  // Create new target that is the shortest from current
-  target = new_turn_target_compute(target, drive_imu_get(), shortest);
-
-  // Calculate error between current and target (target needs to be an in between position)
-  double g_error = target - drive_imu_get();
-  int g_sgn = util::sgn(g_error);
-
-  exit_output turn_exit = RUNNING;
-  exit_output swing_exit = RUNNING;
-
-  pros::Motor& sensor = current_swing == ez::LEFT_SWING ? left_motors[0] : right_motors[0];
-
-  while (true) {
-    g_error = target - drive_imu_get();
-
-    // If turning...
-    if (mode == TURN || mode == TURN_TO_POINT) {
-      // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
-      if (util::sgn(g_error) == g_sgn) {
-        if (turn_exit == RUNNING) {
-          turnPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-          turn_exit = turn_exit != RUNNING ? turn_exit : turnPID.exit_condition({left_motors[0], right_motors[0]});
-          pros::delay(util::DELAY_TIME);
-        } else {
-          if (print_toggle) std::cout << "  Turn: " << exit_to_string(turn_exit) << " Wait Until Exit Failsafe, triggered at " << drive_imu_get() << " instead of " << target << "\n";
-
-          if (turn_exit == mA_EXIT || turn_exit == VELOCITY_EXIT) {
-            interfered = true;
-          }
-          return;
-        }
-      }
-      // Once we've past target, return
-      else if (util::sgn(g_error) != g_sgn) {
-        if (print_toggle) printf("  Turn Wait Until Exit Success, triggered at %.2f.  Target: %.2f\n", drive_imu_get(), target);
-        turnPID.timers_reset();
-        return;
-      }
-    }
-
-    // If swinging...
-    else {
-      // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
-      if (util::sgn(g_error) == g_sgn) {
-        if (swing_exit == RUNNING) {
-          swingPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-          swing_exit = swing_exit != RUNNING ? swing_exit : swingPID.exit_condition(sensor);
-          pros::delay(util::DELAY_TIME);
-        } else {
-          if (print_toggle) std::cout << "  Swing: " << exit_to_string(swing_exit) << " Wait Until Exit Failsafe, triggered at " << drive_imu_get() << " instead of " << target << "\n";
-
-          if (swing_exit == mA_EXIT || swing_exit == VELOCITY_EXIT) {
-            interfered = true;
-          }
-          return;
-        }
-      }
-      // Once we've past target, return
-      else if (util::sgn(g_error) != g_sgn) {
-        if (print_toggle) printf("  Swing Wait Until Exit Success, triggered at %.2f. Target: %.2f\n", drive_imu_get(), target);
-        swingPID.timers_reset();
-        return;
-      }
-    }
+  // This is only used for printing, the trigger computes the same target
+  double shortest_target = new_turn_target_compute(target, drive_imu_get(), shortest);
+  std::string name = mode == SWING ? "Swing" : "Turn";
 
-    pros::delay(util::DELAY_TIME);
+  // ez_auto_task checks the target and the exit conditions, this task sleeps until one of them happens
+  if (pid_motion_get().wait_until(target)) {
+    if (print_toggle) printf("  %s Wait Until Exit Success, triggered at %.2f.  Target: %.2f\n", name.c_str(), drive_imu_get(), shortest_target);
+  } else if (print_toggle) {
+    std::cout << "  " << name << ": " << exit_to_string(motion_primary_exit) << " Wait Until Exit Failsafe, triggered at " << drive_imu_get() << " instead of " << shortest_target << "\n";
   }
 }
 
 void Drive::pid_wait_until(okapi::QLength target) {
+  motion_command_wait();
+
   // If robot is driving...
   if (mode == DRIVE || mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
     wait_until_drive(target.convert(okapi::inch));
@@ -331,6 +306,8 @@ void Drive::pid_wait_until(okapi::QLength target) {
 }
 
 void Drive::pid_wait_until(okapi::QAngle target) {
+  motion_command_wait();
+
   // If robot is driving...
   if (mode == TURN || mode == SWING || mode == TURN_TO_POINT) {
     wait_until_turn_swing(target.convert(okapi::degree));
@@ -340,6 +317,8 @@ void Drive::pid_wait_until(okapi::QAngle target) {
 }
 
 void Drive::pid_wait_until(double target) {
+  motion_command_wait();
+
   // If driving...
   if (mode == DRIVE || mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
     wait_until_drive(target);
@@ -353,36 +332,13 @@ void Drive::pid_wait_until(double target) {
 }
 
 void Drive::pid_wait_until_point(pose target) {
-  pros::delay(10);
-
-  int xy_sgn = util::sgn(is_past_target(target, odom_pose_get()));
-
-  exit_output xy_exit = RUNNING;
-  exit_output a_exit = RUNNING;
-
-  while (true) {
-    xyPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-    current_a_odomPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-    xy_exit = xy_exit != RUNNING ? xy_exit : xyPID.exit_condition({left_motors[0], right_motors[0]});
-    a_exit = a_exit != RUNNING ? a_exit : current_a_odomPID.exit_condition({left_motors[0], right_motors[0]});
-
-    if (xy_exit != RUNNING && a_exit != RUNNING) {
-      if (print_toggle) {
-        std::cout << "  XY: " << exit_to_string(xy_exit) << " Wait Until Exit Failsafe, triggered at (" << odom_x_get() << ", " << odom_y_get() << ") instead of (" << target.x << ", " << target.y << ")\n";
-        xyPID.timers_reset();
-        current_a_odomPID.timers_reset();
-      }
-      return;
-    }
+  motion_command_wait();
 
-    if (util::sgn((is_past_target(target, odom_pose_get()))) != xy_sgn) {
-      if (print_toggle) printf("  XY Wait Until Exit Success, triggered at (%.2f, %.2f).  Target: (%.2f, %.2f)\n", odom_x_get(), odom_y_get(), target.x, target.y);
-      xyPID.timers_reset();
-      current_a_odomPID.timers_reset();
-      return;
-    }
-
-    pros::delay(util::DELAY_TIME);
+  // ez_auto_task checks the target and the exit conditions, this task sleeps until one of them happens
+  if (pid_motion_get().wait_until(target)) {
+    if (print_toggle) printf("  XY Wait Until Exit Success, triggered at (%.2f, %.2f).  Target: (%.2f, %.2f)\n", odom_x_get(), odom_y_get(), target.x, target.y);
+  } else if (print_toggle) {
+    std::cout << "  XY: " << exit_to_string(motion_primary_exit) << " Wait Until Exit Failsafe, triggered at (" << odom_x_get() << ", " << odom_y_get() << ") instead of (" << target.x << ", " << target.y << ")\n";
   }
 }
 
@@ -392,31 +348,15 @@ void Drive::pid_wait_until(united_pose target) { pid_wait_until_point(target); }
 
 // wait for pp
 void Drive::pid_wait_until_index_started(int index) {
-  // Let the PID run at least 1 iteration
-  pros::delay(util::DELAY_TIME);
-
-  if (index > injected_pp_index.size() - 2 || index < 0)
-    printf("  Wait Until PP Error!  Index %i is not within range!  %i is max!\n", index, injected_pp_index.size() - 2);
-  index += 1;
+  motion_command_wait();
 
-  exit_output xy_exit = RUNNING;
-  exit_output a_exit = RUNNING;
-  while (pp_index < injected_pp_index[index]) {
-    xyPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-    current_a_odomPID.velocity_sensor_secondary_set(drive_imu_accel_get());
-    xy_exit = xy_exit != RUNNING ? xy_exit : xyPID.exit_condition({left_motors[0], right_motors[0]});
-    a_exit = a_exit != RUNNING ? a_exit : current_a_odomPID.exit_condition({left_motors[0], right_motors[0]});
-
-    if (xy_exit != RUNNING && a_exit != RUNNING) {
-      if (print_toggle) {
-        std::cout << "  XY: " << exit_to_string(xy_exit) << " Wait Until Exit Failsafe, triggered at (" << odom_x_get() << ", " << odom_y_get() << ") instead of (" << pp_movements[index].target.x << ", " << pp_movements[index].target.y << ")\n";
-        xyPID.timers_reset();
-        current_a_odomPID.timers_reset();
-      }
-      break;
-    }
+  // The trigger prints an error if index is out of range
+  int trigger = pid_trigger_index_add(index);
+  if (trigger == -1) return;
 
-    pros::delay(util::DELAY_TIME);
+  if (!pid_motion_get().wait_until_trigger(trigger) && print_toggle) {
+    pose target = pp_movements[injected_pp_index[index + 1]].target;
+    std::cout << "  XY: " << exit_to_string(motion_primary_exit) << " Wait Until Exit Failsafe, triggered at (" << odom_x_get() << ", " << odom_y_get() << ") instead of (" << target.x << ", " << target.y << ")\n";
   }
 }
 
@@ -429,6 +369,8 @@ void Drive::pid_wait_until_index(int index) {
 
 // Pid wait, but quickly :)
 void Drive::pid_wait_quick() {
+  motion_command_wait();
+
   if (mode == PURE_PURSUIT) {
     pid_wait_until_index(injected_pp_index.size() - 2);
     return;
@@ -479,55 +421,61 @@ double Drive::pid_swing_chain_backward_constant_get() { return swing_backward_mo
 
 // Pid wait that hold momentum into the next motion
 void Drive::pid_wait_quick_chain() {
-  // If driving, add drive_motion_chain_scale to target
-  if (mode == DRIVE) {
-    double chain_scale = motion_chain_backward ? drive_backward_motion_chain_scale : drive_forward_motion_chain_scale;
-    used_motion_chain_scale = chain_scale * util::sgn(chain_target_start);
-    leftPID.target_set(leftPID.target_get() + used_motion_chain_scale);
-    rightPID.target_set(rightPID.target_get() + used_motion_chain_scale);
-  }
+  motion_command_wait();
 
-  // If turning, add turn_motion_chain_scale to target
-  else if (mode == TURN) {
-    used_motion_chain_scale = turn_motion_chain_scale * util::sgn(chain_target_start - chain_sensor_start);
-    turnPID.target_set(turnPID.target_get() + used_motion_chain_scale);
+  if (!(mode == DRIVE || mode == TURN || mode == SWING || mode == POINT_TO_POINT || mode == PURE_PURSUIT)) {
+    printf("Not in a supported drive mode!\n");
+    return;
   }
 
-  // If swinging, add swing_motion_chain_scale to target
-  else if (mode == SWING) {
-    double chain_scale = motion_chain_backward ? swing_backward_motion_chain_scale : swing_forward_motion_chain_scale;
-    used_motion_chain_scale = chain_scale * util::sgn(chain_target_start - chain_sensor_start);
-    swingPID.target_set(swingPID.target_get() + used_motion_chain_scale);
-  }
+  // Targets are moved on ez_auto_task so pp_task never sees pp_movements change under it
+  motion_adjust([this]() {
+    // If driving, add drive_motion_chain_scale to target
+    if (mode == DRIVE) {
+      double chain_scale = motion_chain_backward ? drive_backward_motion_chain_scale : drive_forward_motion_chain_scale;
+      used_motion_chain_scale = chain_scale * util::sgn(chain_target_start);
+      leftPID.target_set(leftPID.target_get() + used_motion_chain_scale);
+      rightPID.target_set(rightPID.target_get() + used_motion_chain_scale);
+    }
 
-  // If odometrying, add drive_motion_chain_scale to the final target point
-  // It'll be at the angle between the second to last point and the last point
-  else if (mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
-    double chain_scale = current_drive_direction == REV ? drive_backward_motion_chain_scale : drive_forward_motion_chain_scale;
-    used_motion_chain_scale = chain_scale;
-
-    // Figure out what angle to use.
-    // this will either by the angle between second to last point and last point,
-    // or it'll be the boomerang end angle
-    double angle = util::absolute_angle_to_point(odom_target_start, odom_second_to_last);
-    if (odom_target_start.theta != ANGLE_NOT_SET) angle = odom_target_start.theta;
-
-    // Create new point
-    pose target = util::vector_off_point(used_motion_chain_scale, {odom_target_start.x, odom_target_start.y, angle});
-    target.theta = odom_target_start.theta;
-
-    // Replace target in ptp, add new final point if pp
-    if (mode == POINT_TO_POINT)
-      odom_target = target;
-    else
-      pp_movements.push_back({target,
-                              pp_movements[pp_movements.size() - 1].drive_direction,
-                              pp_movements[pp_movements.size() - 1].max_xy_speed});
+    // If turning, add turn_motion_chain_scale to target
+    else if (mode == TURN) {
+      used_motion_chain_scale = turn_motion_chain_scale * util::sgn(chain_target_start - chain_sensor_start);
+      turnPID.target_set(turnPID.target_get() + used_motion_chain_scale);
+    }
 
-  } else {
-    printf("Not in a supported drive mode!\n");
-    return;
-  }
+    // If swinging, add swing_motion_chain_scale to target
+    else if (mode == SWING) {
+      double chain_scale = motion_chain_backward ? swing_backward_motion_chain_scale : swing_forward_motion_chain_scale;
+      used_motion_chain_scale = chain_scale * util::sgn(chain_target_start - chain_sensor_start);
+      swingPID.target_set(swingPID.target_get() + used_motion_chain_scale);
+    }
+
+    // If odometrying, add drive_motion_chain_scale to the final target point
+    // It'll be at the angle between the second to last point and the last point
+    else if (mode == POINT_TO_POINT || mode == PURE_PURSUIT) {
+      double chain_scale = current_drive_direction == REV ? drive_backward_motion_chain_scale : drive_forward_motion_chain_scale;
+      used_motion_chain_scale = chain_scale;
+
+      // Figure out what angle to use.
+      // this will either by the angle between second to last point and last point,
+      // or it'll be the boomerang end angle
+      double angle = util::absolute_angle_to_point(odom_target_start, odom_second_to_last);
+      if (odom_target_start.theta != ANGLE_NOT_SET) angle = odom_target_start.theta;
+
+      // Create new point
+      pose target = util::vector_off_point(used_motion_chain_scale, {odom_target_start.x, odom_target_start.y, angle});
+      target.theta = odom_target_start.theta;
+
+      // Replace target in ptp, add new final point if pp
+      if (mode == POINT_TO_POINT)
+        odom_target = target;
+      else
+        pp_movements.push_back({target,
+                                pp_movements[pp_movements.size() - 1].drive_direction,
+                                pp_movements[pp_movements.size() - 1].max_xy_speed});
+    }
+  });
 
   // Exit at the real target
   pid_wait_quick();
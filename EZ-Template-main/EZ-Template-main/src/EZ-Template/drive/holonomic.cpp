@@ -0,0 +1,74 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+void Drive::drive_holonomic_set(bool toggle) { holonomic = toggle; }
+bool Drive::drive_holonomic_get() { return holonomic; }
+
+void Drive::drive_holonomic_output_set(int forward, int strafe, int turn) {
+  drive_mode_set(DISABLE, false);
+  private_drive_set(forward + turn, forward - turn, strafe);
+}
+
+// Front wheels minus back wheels on the left, and back minus front on the right, cancels out driving and turning
+double Drive::drive_sensor_strafe() {
+  if (is_tracker != DRIVE_INTEGRATED || left_motors.size() < 2 || right_motors.size() < 2) return 0.0;
+
+  double left = left_motors.front().get_position() - left_motors.back().get_position();
+  double right = right_motors.back().get_position() - right_motors.front().get_position();
+  return ((left + right) / 4.0) / drive_tick_per_inch();
+}
+
+// Odom to point for holonomic drives.  Driving and turning are separate, so the robot goes straight at the target
+// while turning to holonomic_heading
+void Drive::holonomic_ptp_task() {
+  // Compute slew
+  slew_left.iterate(drive_sensor_left());
+  slew_right.iterate(drive_sensor_right());
+  double max_slew_out = fmax(slew_left.output(), slew_right.output());
+
+  // Compute xy PID, distance is always positive because the direction comes from the field
+  double distance = util::distance_to_point(odom_target, odom_pose_get());
+  new_current_fake += xy_delta_fake;
+  xyPID.compute_error(distance, new_current_fake);
+
+  // Compute angle
+  current_a_odomPID.compute_error(holonomic_heading - odom_theta_get(), odom_theta_get());
+
+  // Rotate the field direction to the target into the robot's forward and strafe directions
+  double forward = 0.0, strafe = 0.0;
+  if (distance != 0.0) {
+    double xy_out = util::clamp(xyPID.output, max_slew_out);
+    double theta = util::to_rad(odom_theta_get());
+    double dx = (odom_target.x - odom_x_get()) / distance;
+    double dy = (odom_target.y - odom_y_get()) / distance;
+    forward = xy_out * ((dx * sin(theta)) + (dy * cos(theta)));
+    strafe = xy_out * ((dx * cos(theta)) - (dy * sin(theta)));
+  }
+  double a_out = current_a_odomPID.output;
+
+  // Scale everything to max speed together so the robot doesn't curve when a wheel would saturate
+  double fastest = fabs(forward) + fabs(strafe) + fabs(a_out);
+  if (fastest > max_slew_out) {
+    forward *= (max_slew_out / fastest);
+    strafe *= (max_slew_out / fastest);
+    a_out *= (max_slew_out / fastest);
+  }
+  xyPID.output_saturated_set(hypot(forward, strafe));
+  current_a_odomPID.output_saturated_set(a_out);
+
+  // Set motors
+  if (drive_toggle)
+    private_drive_set(forward + a_out, forward - a_out, strafe);
+
+  // This is for wait_until
+  leftPID.compute(drive_sensor_left());
+  rightPID.compute(drive_sensor_right());
+}
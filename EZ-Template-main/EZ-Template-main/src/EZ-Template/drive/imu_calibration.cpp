@@ -0,0 +1,133 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <cmath>
+#include <cstdlib>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// Heading from the imu without the scaler applied
+double Drive::imu_unscaled_get() {
+  if (IMU_SCALER == 0.0) return 0.0;
+  return drive_imu_get() / IMU_SCALER;
+}
+
+// Heading from the difference between the left and right tracking wheels, in degrees
+double Drive::imu_tracker_heading_get() {
+  double width = odom_tracker_right->distance_to_center_get() - odom_tracker_left->distance_to_center_get();
+  if (width == 0.0) return 0.0;
+  return util::to_deg((odom_tracker_left->get() - odom_tracker_right->get()) / width);
+}
+
+double Drive::drive_imu_scaler_calibrate(int revolutions, int speed, double wall_distance) {
+  if (!drive_imu_calibrated()) {
+    printf("IMU scaler calibration failed, the IMU isn't calibrated!\n");
+    return IMU_SCALER;
+  }
+  if (revolutions < 2) {
+    printf("IMU scaler calibration needs at least 2 revolutions to find the variance!\n");
+    return IMU_SCALER;
+  }
+
+  // Two parallel tracking wheels know how far the robot turned, without them the wall squares the robot up
+  bool trackers = odom_tracker_left_enabled && odom_tracker_right_enabled;
+  printf("Calibrating IMU scaler over %i revolutions using %s.\n", revolutions, trackers ? "tracking wheels" : "the wall");
+
+  std::vector<double> samples;
+  double target = drive_imu_get();
+  for (int i = 0; i < revolutions; i++) {
+    double imu_start = imu_unscaled_get();
+    double reference_start = trackers ? imu_tracker_heading_get() : 0.0;
+
+    // Get off the wall so the corners don't hit it while turning
+    if (!trackers) {
+      pid_drive_set(wall_distance, speed);
+      pid_wait();
+    }
+
+    target += 360.0;
+    pid_turn_set(target, speed, ez::raw);
+    pid_wait();
+
+    // Back into the wall so it turns the robot exactly one revolution
+    if (!trackers) {
+      drive_set(-30, -30);
+      pros::delay(750);
+      drive_set(0, 0);
+      pros::delay(250);
+    }
+
+    double imu_turned = imu_unscaled_get() - imu_start;
+    double reference_turned = trackers ? imu_tracker_heading_get() - reference_start : 360.0;
+    if (imu_turned == 0.0) {
+      printf("IMU scaler calibration failed, the IMU didn't move!\n");
+      return IMU_SCALER;
+    }
+    samples.push_back(reference_turned / imu_turned);
+    printf("  Revolution %i: IMU %.2f, reference %.2f, scaler %.5f\n", i + 1, imu_turned, reference_turned, samples.back());
+
+    // The next turn starts from where the robot actually is
+    target = drive_imu_get();
+  }
+  drive_set(0, 0);
+
+  // Mean and sample variance of every revolution
+  double mean = 0.0;
+  for (auto i : samples) mean += i;
+  mean /= samples.size();
+  double variance = 0.0;
+  for (auto i : samples) variance += (i - mean) * (i - mean);
+  variance /= (samples.size() - 1);
+
+  IMU_SCALER = mean;
+  imu_scaler_variance = variance;
+  save_imu_scaler_sd();
+  printf("IMU scaler is %.5f, variance %.8f\n", mean, variance);
+  return mean;
+}
+
+double Drive::drive_imu_scaler_variance_get() { return imu_scaler_variance; }
+
+void Drive::drive_imu_scaler_sd_initialize() {
+  // If no SD card, return
+  if (!ez::util::SD_CARD_ACTIVE) return;
+
+  // Nothing is created when the file doesn't exist, so the scaler set in code is used until the robot is calibrated
+  FILE* usd_file_read;
+  if ((usd_file_read = fopen("/usd/imu_scaler.txt", "r"))) {
+    char buf[32] = {0};
+    fread(buf, 1, sizeof(buf) - 1, usd_file_read);
+    fclose(usd_file_read);
+
+    // A corrupt file keeps the scaler set in code
+    char* end;
+    double scaler = strtod(buf, &end);
+    if (end == buf || scaler <= 0.0) {
+      printf("imu_scaler.txt is corrupt, using IMU scaler %.5f\n", IMU_SCALER);
+      return;
+    }
+    char* variance_end;
+    double variance = strtod(end, &variance_end);
+    IMU_SCALER = scaler;
+    imu_scaler_variance = variance_end == end ? 0.0 : variance;
+    printf("Loaded IMU scaler %.5f from imu_scaler.txt\n", IMU_SCALER);
+  }
+}
+
+void Drive::save_imu_scaler_sd() {
+  // If no SD card, return
+  if (!ez::util::SD_CARD_ACTIVE) return;
+
+  FILE* usd_file_write = fopen("/usd/imu_scaler.txt", "w");
+  if (usd_file_write == nullptr) return;
+  char out[32];
+  snprintf(out, sizeof(out), "%.6f %.10f", IMU_SCALER, imu_scaler_variance);
+  fputs(out, usd_file_write);
+  fclose(usd_file_write);
+}
@@ -0,0 +1,120 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <cmath>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// imu_iterate reads the secondary imu every tick, so it's swapped in at the start of a tick
+void Drive::drive_imu_secondary_set(int port) {
+  motion_config([this, port]() {
+    imu_secondary.emplace(abs(port));
+    imu_secondary->set_data_rate(5);
+    imu_primary_state = imu_state_();
+    imu_secondary_state = imu_state_();
+    imu_secondary_scale = 1.0;
+    imu_fused = imu.get_rotation();
+    imu_secondary_port = abs(port);
+  });
+}
+
+std::vector<double> Drive::drive_imu_drift_get() {
+  double ticks_per_second = 1000.0 / util::DELAY_TIME;
+  return {imu_primary_state.drift * ticks_per_second, imu_secondary_state.drift * ticks_per_second};
+}
+
+// The first thing in a tick that needs acceleration reads it, everything after that shares the reading
+const pros::imu_accel_s_t& Drive::imu_accel_tick() {
+  if (!imu_accel_fresh) {
+    imu_accel = imu.get_accel();
+    imu_accel_fresh = true;
+  }
+  return imu_accel;
+}
+
+// Reads how far one imu turned this tick with its drift taken out.  Returns false when there's no usable reading
+bool Drive::imu_sample(pros::Imu& sensor, imu_state_& state, double& delta, bool still, const char* name) {
+  double current = sensor.get_rotation();
+
+  // Unplugged imus return PROS_ERR_F, and a change faster than the imu can measure is a glitch
+  bool valid = current != PROS_ERR_F && !std::isnan(current);
+  if (valid && !std::isnan(state.last) && fabs(current - state.last) > 30.0) valid = false;
+  if (valid == state.failed) {
+    state.failed = !valid;
+    printf(valid ? "%s IMU is working again.\n" : "%s IMU failed!  Using the other IMU.\n", name);
+  }
+  if (!valid) {
+    state.last = NAN;
+    return false;
+  }
+
+  if (std::isnan(state.last)) {
+    state.last = current;
+    return false;
+  }
+  delta = current - state.last;
+  state.last = current;
+
+  // Anything the imu reads while the robot is still is drift, which is learned slowly so a bump doesn't throw it off
+  if (still) {
+    state.drift += (delta - state.drift) * 0.002;
+    state.noise += (((delta - state.drift) * (delta - state.drift)) - state.noise) * 0.002;
+  }
+  delta -= state.drift;
+  return true;
+}
+
+// Sets every imu to the new heading and starts fusing from there
+void Drive::imu_reset_apply(double new_heading) {
+  imu.set_rotation(new_heading);
+  if (!imu_secondary) return;
+  imu_secondary->set_rotation(new_heading);
+  imu_primary_state.last = NAN;
+  imu_secondary_state.last = NAN;
+  imu_fused = new_heading;
+}
+
+// Fuses both imus into one heading, this runs once per tick in ez_auto_task before odom
+void Drive::imu_iterate() {
+  if (!imu_secondary) return;
+  double reset = imu_reset_heading.exchange(NAN);
+  if (!std::isnan(reset)) imu_reset_apply(reset);
+  if (!imu_calibration_complete) {
+    imu_primary_state.last = NAN;
+    imu_secondary_state.last = NAN;
+    return;
+  }
+
+  bool still = drive_velocity_left() == 0 && drive_velocity_right() == 0;
+  double primary = 0.0, secondary = 0.0;
+  bool primary_valid = imu_sample(imu, imu_primary_state, primary, still, "Primary");
+  bool secondary_valid = imu_sample(*imu_secondary, imu_secondary_state, secondary, still, "Secondary");
+
+  // Match the secondary's scale to the primary, only while turning so noise doesn't get counted
+  if (primary_valid && secondary_valid && fabs(primary) > 0.2) {
+    imu_primary_state.travel += fabs(primary);
+    imu_secondary_state.travel += fabs(secondary);
+    if (imu_primary_state.travel > 90.0 && imu_secondary_state.travel != 0.0)
+      imu_secondary_scale = util::clamp(imu_primary_state.travel / imu_secondary_state.travel, 1.05, 0.95);
+  }
+  secondary *= imu_secondary_scale;
+
+  // Weight each imu by how noisy it is, or use whichever one is still working
+  double delta = 0.0;
+  if (primary_valid && secondary_valid) {
+    double primary_weight = 1.0 / fmax(imu_primary_state.noise, 1e-9);
+    double secondary_weight = 1.0 / fmax(imu_secondary_state.noise, 1e-9);
+    delta = ((primary * primary_weight) + (secondary * secondary_weight)) / (primary_weight + secondary_weight);
+  } else if (primary_valid) {
+    delta = primary;
+  } else if (secondary_valid) {
+    delta = secondary;
+  }
+  imu_fused = imu_fused.load() + delta;
+}
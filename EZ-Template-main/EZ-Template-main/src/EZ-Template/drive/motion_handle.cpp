@@ -0,0 +1,106 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/motion_handle.hpp"
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+motion_handle::motion_handle(Drive* drive, std::uint32_t id) : drive(drive), id(id) {}
+
+std::uint32_t motion_handle::id_get() { return id; }
+exit_output motion_handle::exit_reason_get() { return drive->motion_exit_get(id); }
+bool motion_handle::done() { return exit_reason_get() != RUNNING; }
+
+// Only the running motion can be cancelled, older motions already finished
+void motion_handle::cancel() {
+  if (done()) return;
+  drive->drive_mode_set(DISABLE);
+}
+
+// Sleep until ez_auto_task wakes this task and condition() is true, or the motion exits
+bool motion_handle::wait_for(std::function<bool()> condition) {
+  pros::task_t self = pros::c::task_get_current();
+  drive->motion_waiter_add(self);
+
+  // Check the condition first, it may have been met on the same tick the motion exited
+  bool reached = false;
+  while (true) {
+    if (condition()) {
+      reached = true;
+      break;
+    }
+    if (done()) break;
+    drive->motion_tick_wait();
+  }
+
+  drive->motion_waiter_remove(self);
+  return reached;
+}
+
+exit_output motion_handle::wait() {
+  wait_for([] { return false; });
+  return exit_reason_get();
+}
+
+// Position waits are triggers that ez_auto_task checks every tick, this task only looks at the result
+bool motion_handle::wait_until_trigger(int trigger) {
+  if (trigger == -1) return false;
+  return wait_for([&] { return drive->pid_trigger_fired(trigger); });
+}
+
+bool motion_handle::wait_until_drive(double target) { return wait_until_trigger(drive->pid_trigger_distance_add(target)); }
+bool motion_handle::wait_until_turn_swing(double target) { return wait_until_trigger(drive->pid_trigger_angle_add(target)); }
+
+bool motion_handle::wait_until(double target) {
+  drive->motion_command_wait();
+  if (done()) return false;
+
+  e_mode mode = drive->drive_mode_get();
+  if (mode == DRIVE || mode == POINT_TO_POINT || mode == PURE_PURSUIT)
+    return wait_until_drive(target);
+  else if (mode == TURN || mode == SWING || mode == TURN_TO_POINT)
+    return wait_until_turn_swing(target);
+
+  printf("Not in a valid drive mode!\n");
+  return false;
+}
+
+bool motion_handle::wait_until(okapi::QLength target) {
+  drive->motion_command_wait();
+  if (done()) return false;
+
+  e_mode mode = drive->drive_mode_get();
+  if (!(mode == DRIVE || mode == POINT_TO_POINT || mode == PURE_PURSUIT)) {
+    printf("QLength not supported for turn or swing!\n");
+    return false;
+  }
+  return wait_until_drive(target.convert(okapi::inch));
+}
+
+bool motion_handle::wait_until(okapi::QAngle target) {
+  drive->motion_command_wait();
+  if (done()) return false;
+
+  e_mode mode = drive->drive_mode_get();
+  if (!(mode == TURN || mode == SWING || mode == TURN_TO_POINT)) {
+    printf("QAngle not supported for drive!\n");
+    return false;
+  }
+  return wait_until_turn_swing(target.convert(okapi::degree));
+}
+
+// Wait until the robot has crossed the line through target, perpendicular to the robot
+bool motion_handle::wait_until(pose target) {
+  drive->motion_command_wait();
+  if (done()) return false;
+
+  return wait_until_trigger(drive->pid_trigger_point_add(target));
+}
+
+bool motion_handle::wait_until(united_pose target) { return wait_until(util::united_pose_to_pose(target)); }
@@ -0,0 +1,204 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <cmath>
+#include <cstdlib>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/tracking_wheel.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+static const char* tracker_names[4] = {"Left", "Right", "Back", "Front"};
+
+// Trackers in the order they're saved, nullptr when that tracker isn't used
+tracking_wheel* Drive::odom_calibration_tracker(int index) {
+  if (index == 0 && odom_tracker_left_enabled) return odom_tracker_left;
+  if (index == 1 && odom_tracker_right_enabled) return odom_tracker_right;
+  if (index == 2 && odom_tracker_back_enabled) return odom_tracker_back;
+  if (index == 3 && odom_tracker_front_enabled) return odom_tracker_front;
+  return nullptr;
+}
+
+// Average of the front distance sensor while the robot is still, NAN without a good reading
+double Drive::odom_calibration_distance_get() {
+  if (!dist_front) return NAN;
+  double sum = 0.0;
+  int count = 0;
+  for (int i = 0; i < 10; i++) {
+    double reading = dist_front->get() / 25.4;
+    if (reading > 0.5 && reading < 120.0) {
+      sum += reading;
+      count++;
+    }
+    pros::delay(util::DELAY_TIME);
+  }
+  return count == 0 ? NAN : sum / count;
+}
+
+void Drive::drive_odom_calibrate(int samples, double distance, int speed) {
+  if (!drive_imu_calibrated()) {
+    printf("Odom calibration failed, the IMU isn't calibrated!\n");
+    return;
+  }
+  if (samples < 1) samples = 1;
+  bool has_vertical = odom_calibration_tracker(0) != nullptr || odom_calibration_tracker(1) != nullptr;
+
+  // Least squares through the origin for each tracker, measured = slope * reference.  Sums are {reference * measured, reference^2}
+  double drive_fit[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  double turn_fit[4][2] = {{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}};
+  double width_fit[2] = {0.0, 0.0};
+
+  // Straight drives find the diameter of the vertical trackers.  This needs something that measures the field,
+  // the drive motors only know the wheel diameter they were told and slip
+  if (has_vertical && dist_front == nullptr)
+    printf("Skipping tracker diameters, this needs a front distance sensor.  Using the diameters set in code.\n");
+  if (has_vertical && dist_front != nullptr) {
+    printf("Calibrating tracker diameters against the front distance sensor.\n");
+    for (int i = 0; i < samples * 2; i++) {
+      // Alternate driving towards and away from the wall so the robot ends up where it started
+      double target = i % 2 == 0 ? distance : -distance;
+      double reference_start = odom_calibration_distance_get();
+      double tracker_start[2];
+      for (int j = 0; j < 2; j++) tracker_start[j] = odom_calibration_tracker(j) != nullptr ? odom_calibration_tracker(j)->get() : 0.0;
+
+      pid_drive_set(target, speed);
+      pid_wait();
+      pros::delay(250);
+
+      // The distance sensor reads less as the robot drives forward
+      double reference = reference_start - odom_calibration_distance_get();
+      if (std::isnan(reference)) {
+        printf("  Drive %i: no distance sensor reading, skipping it\n", i + 1);
+        continue;
+      }
+      for (int j = 0; j < 2; j++) {
+        if (odom_calibration_tracker(j) == nullptr) continue;
+        double measured = odom_calibration_tracker(j)->get() - tracker_start[j];
+        drive_fit[j][0] += reference * measured;
+        drive_fit[j][1] += reference * reference;
+      }
+    }
+  }
+
+  // Spins find the offset of every tracker and the track width of the drive, the IMU is the reference
+  printf("Calibrating tracker offsets and track width against the IMU.\n");
+  for (int i = 0; i < samples * 2; i++) {
+    double angle_start = util::to_rad(drive_imu_get());
+    double tracker_start[4];
+    for (int j = 0; j < 4; j++) tracker_start[j] = odom_calibration_tracker(j) != nullptr ? odom_calibration_tracker(j)->get() : 0.0;
+    double width_start = drive_sensor_right() - drive_sensor_left();
+
+    // Alternate directions so the robot ends up where it started
+    pid_turn_relative_set(i % 2 == 0 ? 360.0 : -360.0, speed, ez::raw);
+    pid_wait();
+    pros::delay(250);
+
+    double angle = util::to_rad(drive_imu_get()) - angle_start;
+    for (int j = 0; j < 4; j++) {
+      if (odom_calibration_tracker(j) == nullptr) continue;
+      double measured = odom_calibration_tracker(j)->get() - tracker_start[j];
+      turn_fit[j][0] += angle * measured;
+      turn_fit[j][1] += angle * angle;
+    }
+    double width = (drive_sensor_right() - drive_sensor_left()) - width_start;
+    width_fit[0] += angle * width;
+    width_fit[1] += angle * angle;
+  }
+  drive_set(0, 0);
+
+  // Trackers that read too far have a smaller wheel than they were told.  Back and front trackers don't turn while
+  // driving straight, so their diameters are never found here
+  for (int j = 0; j < 4; j++) {
+    tracking_wheel* tracker = odom_calibration_tracker(j);
+    if (tracker == nullptr) continue;
+
+    double scale = 1.0;
+    if (j < 2 && drive_fit[j][1] != 0.0 && drive_fit[j][0] != 0.0) {
+      scale = drive_fit[j][0] / drive_fit[j][1];
+      odom_calibration.diameter[j] = tracker->wheel_diameter_get() / fabs(scale);
+    }
+
+    // Solve the same model tracking uses for a turn in place, vertical trackers read -offset * angle and
+    // horizontal trackers read offset * angle.  Readings are in the old diameter's inches, so scale them too
+    if (turn_fit[j][1] != 0.0) {
+      double offset = (turn_fit[j][0] / turn_fit[j][1]) / fabs(scale);
+      odom_calibration.offset[j] = j < 2 ? -offset : offset;
+    }
+    double diameter = odom_calibration.diameter[j] > 0.0 ? odom_calibration.diameter[j] : tracker->wheel_diameter_get();
+    printf("%s tracker: diameter %.4f%s, distance to center %.4f\n", tracker_names[j], diameter, odom_calibration.diameter[j] > 0.0 ? "" : " (from code)", odom_calibration.offset[j]);
+  }
+
+  // The track width is only used when a side doesn't have a tracker
+  if (is_tracker != ODOM_TRACKER && width_fit[1] != 0.0) {
+    odom_calibration.track_width = fabs(width_fit[0] / width_fit[1]);
+    printf("Track width: %.4f\n", odom_calibration.track_width);
+  }
+
+  odom_calibration_apply();
+  save_odom_calibration_sd();
+}
+
+// Give every tracker and the drive its calibrated geometry, anything that wasn't calibrated is left alone
+void Drive::odom_calibration_apply() {
+  for (int j = 0; j < 4; j++) {
+    tracking_wheel* tracker = odom_calibration_tracker(j);
+    if (tracker == nullptr) continue;
+    if (odom_calibration.diameter[j] > 0.0) tracker->wheel_diameter_set(odom_calibration.diameter[j]);
+    if (odom_calibration.offset[j] != 0.0) {
+      tracker->distance_to_center_set(odom_calibration.offset[j]);
+      tracker->distance_to_center_flip_set(odom_calibration.offset[j] < 0.0);
+    }
+  }
+  if (odom_calibration.track_width > 0.0) drive_width_set(odom_calibration.track_width);
+}
+
+void Drive::drive_odom_calibration_sd_initialize() {
+  // If no SD card, return
+  if (!ez::util::SD_CARD_ACTIVE) return;
+
+  // Nothing is created when the file doesn't exist, so the geometry set in code is used until the robot is calibrated
+  FILE* usd_file_read;
+  if ((usd_file_read = fopen("/usd/odom_calibration.txt", "r"))) {
+    char buf[256] = {0};
+    fread(buf, 1, sizeof(buf) - 1, usd_file_read);
+    fclose(usd_file_read);
+
+    // Left, right, back and front diameter and offset, then track width
+    double values[9] = {0.0};
+    char* read = buf;
+    for (int i = 0; i < 9; i++) {
+      char* end;
+      values[i] = strtod(read, &end);
+      if (end == read) return;
+      read = end;
+    }
+    for (int j = 0; j < 4; j++) {
+      odom_calibration.diameter[j] = values[j * 2];
+      odom_calibration.offset[j] = values[(j * 2) + 1];
+    }
+    odom_calibration.track_width = values[8];
+    odom_calibration_apply();
+    printf("Loaded odom calibration from odom_calibration.txt\n");
+  }
+}
+
+void Drive::save_odom_calibration_sd() {
+  // If no SD card, return
+  if (!ez::util::SD_CARD_ACTIVE) return;
+
+  FILE* usd_file_write = fopen("/usd/odom_calibration.txt", "w");
+  if (usd_file_write == nullptr) return;
+  char out[32];
+  for (int j = 0; j < 4; j++) {
+    snprintf(out, sizeof(out), "%.6f %.6f\n", odom_calibration.diameter[j], odom_calibration.offset[j]);
+    fputs(out, usd_file_write);
+  }
+  snprintf(out, sizeof(out), "%.6f\n", odom_calibration.track_width);
+  fputs(out, usd_file_write);
+  fclose(usd_file_write);
+}
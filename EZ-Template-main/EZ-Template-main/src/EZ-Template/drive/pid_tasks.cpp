@@ -12,9 +12,30 @@ using namespace ez;
 
 void Drive::ez_auto_task() {
   while (true) {
+    // Read every drive motor
+    sensors_iterate();
+
+    // Fuse imus
+    imu_iterate();
+
+    // Start any motion that was set since the last tick
+    command_iterate();
+
+    // Apply pto changes at the start of the tick
+    pto_iterate();
+
     // Run odom
     ez_tracking_task();
 
+    // Check for wheel slip
+    slip_iterate();
+
+    // Filter battery voltage
+    battery_iterate();
+
+    // Split current limits between motors
+    budget_iterate();
+
     // Autonomous PID
     switch (drive_mode_get()) {
       case DRIVE:
@@ -38,6 +59,11 @@ void Drive::ez_auto_task() {
         break;
     }
 
+    // Compute exit conditions and triggers once per tick, then wake anything waiting on the motion
+    exit_conditions_iterate();
+    triggers_iterate();
+    motion_waiters_notify();
+
     // This is used to reset sensors for active braking
     util::AUTON_RAN = drive_mode_get() != DISABLE ? true : false;
 
@@ -48,6 +74,8 @@ void Drive::ez_auto_task() {
 // Drive PID task
 void Drive::drive_pid_task() {
   // Compute PID
+  leftPID.gain_schedule_iterate(drive_sensor_left());
+  rightPID.gain_schedule_iterate(drive_sensor_right());
   leftPID.compute(drive_sensor_left());
   rightPID.compute(drive_sensor_right());
 
@@ -69,6 +97,10 @@ void Drive::drive_pid_task() {
     r_drive_out *= (max_slew_out / faster_side);
   }
 
+  // Let the PIDs know how much slew clamped them for anti-windup
+  leftPID.output_saturated_set(l_drive_out);
+  rightPID.output_saturated_set(r_drive_out);
+
   // Toggle heading
   double imu_out = heading_on ? headingPID.output : 0;
 
@@ -86,13 +118,14 @@ void Drive::drive_pid_task() {
 
   // Set motors
   if (drive_toggle)
-    private_drive_set(l_out, r_out);
+    private_drive_auto_set(l_out, r_out);
 }
 
 // Turn PID task
 void Drive::turn_pid_task() {
   // Compute PID if it's a normal turn
   if (mode == TURN) {
+    turnPID.gain_schedule_iterate(drive_imu_get());
     turnPID.compute(drive_imu_get());
   }
   // Compute PID if we're turning to point
@@ -114,15 +147,17 @@ void Drive::turn_pid_task() {
     if (pid_turn_min_get() != 0)
       gyro_out = util::clamp(gyro_out, pid_turn_min_get(), -pid_turn_min_get());
   }
+  turnPID.output_saturated_set(gyro_out);
 
   // Set motors
   if (drive_toggle)
-    private_drive_set(gyro_out, -gyro_out);
+    private_drive_auto_set(gyro_out, -gyro_out);
 }
 
 // Swing PID task
 void Drive::swing_pid_task() {
   // Compute PID
+  swingPID.gain_schedule_iterate(drive_imu_get());
   swingPID.compute(drive_imu_get());
   leftPID.compute(drive_sensor_left());
   rightPID.compute(drive_sensor_right());
@@ -139,6 +174,7 @@ void Drive::swing_pid_task() {
     if (pid_swing_min_get() != 0)
       swing_out = util::clamp(swing_out, pid_swing_min_get(), -pid_swing_min_get());
   }
+  swingPID.output_saturated_set(swing_out);
 
   // Set the motors powers, and decide what to do with the "still" side of the drive
   double opposite_output = 0;
@@ -147,16 +183,21 @@ void Drive::swing_pid_task() {
     // Check if left or right swing, then set motors accordingly
     if (current_swing == LEFT_SWING) {
       opposite_output = swing_opposite_speed == 0 ? rightPID.output : (swing_opposite_speed * scale);
-      private_drive_set(swing_out, opposite_output);
+      private_drive_auto_set(swing_out, opposite_output);
     } else if (current_swing == RIGHT_SWING) {
       opposite_output = swing_opposite_speed == 0 ? leftPID.output : -(swing_opposite_speed * scale);
-      private_drive_set(opposite_output, -swing_out);
+      private_drive_auto_set(opposite_output, -swing_out);
     }
   }
 }
 
 // Odom To Point Task
 void Drive::ptp_task() {
+  if (holonomic) {
+    holonomic_ptp_task();
+    return;
+  }
+
   // Compute slew
   slew_left.iterate(drive_sensor_left());
   slew_right.iterate(drive_sensor_right());
@@ -196,6 +237,8 @@ void Drive::ptp_task() {
     xy_out *= (max_slew_out / faster_side);
     a_out *= (max_slew_out / faster_side);
   }
+  xyPID.output_saturated_set(xy_out);
+  current_a_odomPID.output_saturated_set(a_out);
 
   // Combine heading and drive
   double l_out = xy_out + a_out;
@@ -217,7 +260,7 @@ void Drive::ptp_task() {
 
   // Set motors
   if (drive_toggle)
-    private_drive_set(l_out, r_out);
+    private_drive_auto_set(l_out, r_out);
 
   // This is for wait_until
   leftPID.compute(drive_sensor_left());
@@ -263,7 +306,8 @@ void Drive::pp_task() {
     }
   }
 
-  if (pp_movements[pp_index].target.theta != ANGLE_NOT_SET) {
+  // Holonomic drives can turn to the final angle while driving, so they don't need boomerang's carrot point
+  if (pp_movements[pp_index].target.theta != ANGLE_NOT_SET && !holonomic) {
     boomerang_task();
   } else {
     ptp_task();
@@ -4,6 +4,7 @@ License, v. 2.0. If a copy of the MPL was not distributed with this
 file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
+#include "EZ-Template/controller_input.hpp"
 #include "EZ-Template/drive/drive.hpp"
 #include "EZ-Template/sdcard.hpp"
 #include "EZ-Template/util.hpp"
@@ -176,12 +177,12 @@ void Drive::pid_tuner_iterate() {
   }
 
   // Up / Down for Rows
-  if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_RIGHT)) {
+  if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_RIGHT)) {
     column++;
     if (column > used_pid_tuner_pids->size() - 1)
       column = 0;
     pid_tuner_print();
-  } else if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_LEFT)) {
+  } else if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_LEFT)) {
     column--;
     if (column < 0)
       column = used_pid_tuner_pids->size() - 1;
@@ -189,12 +190,12 @@ void Drive::pid_tuner_iterate() {
   }
 
   // Left / Right for Columns
-  if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_DOWN)) {
+  if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_DOWN)) {
     row++;
     if (row > 3)
       row = 0;
     pid_tuner_print();
-  } else if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_UP)) {
+  } else if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_UP)) {
     row--;
     if (row < 0)
       row = 3;
@@ -202,10 +203,10 @@ void Drive::pid_tuner_iterate() {
   }
 
   // Increase / Decrease constant
-  if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_A)) {
+  if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_A)) {
     pid_tuner_value_increase();
     pid_tuner_print();
-  } else if (master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_Y)) {
+  } else if (master_input.digital_new_press(pros::E_CONTROLLER_DIGITAL_Y)) {
     pid_tuner_value_decrease();
     pid_tuner_print();
   }
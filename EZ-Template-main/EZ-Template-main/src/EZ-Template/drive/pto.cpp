@@ -4,45 +4,41 @@ License, v. 2.0. If a copy of the MPL was not distributed with this
 file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
-#include <algorithm>
 #include <vector>
 
 #include "EZ-Template/drive/drive.hpp"
 
-bool Drive::pto_check(pros::Motor check_if_pto) {
-  auto does_exist = std::find(pto_active.begin(), pto_active.end(), check_if_pto.get_port());
-  if (does_exist != pto_active.end())
-    return true;  // Motor is in the list
-  return false;   // Motor isn't in the list
+std::uint32_t Drive::pto_bit(int port) { return 1u << (abs(port) - 1); }
+
+bool Drive::pto_check(const pros::Motor& check_if_pto) {
+  return pto_active.load() & pto_bit(check_if_pto.get_port());
 }
 
 void Drive::pto_add(std::vector<pros::Motor> pto_list) {
-  for (auto i : pto_list) {
-    // Return if the motor is already in the list
-    if (pto_check(i)) return;
-
-    // Return if the first index was used (this motor is used for velocity)
-    if (i.get_port() == left_motors[0].get_port() || i.get_port() == right_motors[0].get_port()) {
-      printf("You cannot PTO the first index!\n");
-      return;
-    }
+  std::uint32_t bits = 0;
+  for (auto& i : pto_list) {
+    bits |= pto_bit(i.get_port());
+  }
 
-    pto_active.push_back(i.get_port());
+  // Drive sensors are fused from every motor that isn't pto'd, so at least one motor per side has to stay
+  for (auto side : {&left_motors, &right_motors}) {
+    bool all = true;
+    for (auto& i : *side) all = all && ((pto_requested.load() | bits) & pto_bit(i.get_port()));
+    if (all) printf("Every motor on one side of the drive is pto'd!  Drive sensors will hold their last position.\n");
   }
+
+  // ez_auto_task applies this at the start of the next tick
+  pto_requested.fetch_or(bits);
 }
 
 void Drive::pto_remove(std::vector<pros::Motor> pto_list) {
-  for (auto i : pto_list) {
-    auto does_exist = std::find(pto_active.begin(), pto_active.end(), i.get_port());
-    // Return if the motor isn't in the list
-    if (does_exist == pto_active.end()) return;
-
-    // Find index of motor
-    int index = std::distance(pto_active.begin(), does_exist);
-    pto_active.erase(pto_active.begin() + index);
-    i.set_brake_mode(CURRENT_BRAKE);  // Set the motor to the brake type of the drive
-    i.set_current_limit(CURRENT_MA);  // Set the motor to the mA of the drive
+  std::uint32_t bits = 0;
+  for (auto& i : pto_list) {
+    bits |= pto_bit(i.get_port());
   }
+
+  // ez_auto_task applies this at the start of the next tick
+  pto_requested.fetch_and(~bits);
 }
 
 void Drive::pto_toggle(std::vector<pros::Motor> pto_list, bool toggle) {
@@ -50,4 +46,42 @@ void Drive::pto_toggle(std::vector<pros::Motor> pto_list, bool toggle) {
     pto_add(pto_list);
   else
     pto_remove(pto_list);
-}
\ No newline at end of file
+}
+
+void Drive::pto_transition_set(int time) { pto_ramp_time = abs(time); }
+void Drive::pto_transition_set(okapi::QTime p_time) { pto_transition_set((int)p_time.convert(okapi::millisecond)); }
+int Drive::pto_transition_get() { return pto_ramp_time; }
+bool Drive::pto_transitioning() { return pto_requested.load() != pto_active.load(); }
+
+// Switches pto motors between ticks, so private_drive_set never sees a half applied change
+void Drive::pto_iterate() {
+  std::uint32_t requested = pto_requested.load();
+  std::uint32_t active = pto_active.load();
+  if (requested == active) {
+    pto_ramping.store(0);
+    return;
+  }
+
+  // Motors coming back to the drive get the drive's settings again
+  std::uint32_t returning = active & ~requested;
+  for (int port = 1; returning != 0; port++, returning >>= 1) {
+    if (!(returning & 1)) continue;
+    pros::c::motor_set_brake_mode(port, CURRENT_BRAKE);  // Set the motor to the brake type of the drive
+    pros::c::motor_set_current_limit(port, CURRENT_MA);  // Set the motor to the mA of the drive
+  }
+
+  // Motors leaving the drive ramp down before they're handed over, a new request restarts the ramp
+  std::uint32_t leaving = requested & ~active;
+  if (leaving != pto_ramping.load()) {
+    pto_ramping.store(leaving);
+    pto_ramp_timer.store(0);
+  }
+  if (pto_ramp_timer.load() < pto_ramp_time) {
+    pto_ramp_timer += util::DELAY_TIME;
+    pto_active.store(requested & ~leaving);
+    return;
+  }
+
+  pto_ramping.store(0);
+  pto_active.store(requested);
+}
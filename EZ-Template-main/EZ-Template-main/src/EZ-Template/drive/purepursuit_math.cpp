@@ -256,8 +256,8 @@ std::vector<odom> Drive::smooth_path(std::vector<odom> ipath, double weight_smoo
 // to bias one way
 double Drive::turn_short(double target, double current, bool print) {
   if (print) printf("SHORTEST   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double shortest = util::turn_shortest(target, current, false);
-  double longest = util::turn_longest(target, current, false);
+  double shortest = util::angle_shortest(target, current);
+  double longest = util::angle_longest(target, current);
   double output = turn_is_toleranced(target, current, shortest, longest, shortest);
   if (print) printf("%.2f\n", output);
   return output;
@@ -267,8 +267,8 @@ double Drive::turn_short(double target, double current, bool print) {
 // to bias one way
 double Drive::turn_long(double target, double current, bool print) {
   if (print) printf("LONGEST   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double longest = util::turn_longest(target, current, false);
-  double shortest = util::turn_shortest(target, current, false);
+  double longest = util::angle_longest(target, current);
+  double shortest = util::angle_shortest(target, current);
   double output = turn_is_toleranced(target, current, longest, longest, shortest);
   if (print) printf("%.2f\n", output);
   return output;
@@ -297,37 +297,15 @@ double Drive::turn_is_toleranced(double target, double current, double input, do
 
 // Always turn left
 double Drive::turn_left(double target, double current, bool print) {
-  if (print) printf("LEFT   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double shortest = util::turn_shortest(target, current, false);
-  double output = shortest;
-  if (util::sgn(shortest - current) == -1) {
-    output = shortest;
-
-    return output;
-  }
-
-  double longest = util::turn_longest(target, current, false);
-  output = longest;
-
-  if (print) printf("%.2f\n", output);
+  double output = util::angle_left(target, current);
+  if (print) printf("LEFT   Target: %.2f   Current: %.2f      New Target: %.2f\n", target, current, output);
   return output;
 }
 
 // Always turn right
 double Drive::turn_right(double target, double current, bool print) {
-  if (print) printf("LEFT   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double shortest = util::turn_shortest(target, current, false);
-  double output = shortest;
-  if (util::sgn(shortest - current) == 1) {
-    output = shortest;
-
-    return output;
-  }
-
-  double longest = util::turn_longest(target, current, false);
-  output = longest;
-
-  if (print) printf("%.2f\n", output);
+  double output = util::angle_right(target, current);
+  if (print) printf("RIGHT   Target: %.2f   Current: %.2f      New Target: %.2f\n", target, current, output);
   return output;
 }
 
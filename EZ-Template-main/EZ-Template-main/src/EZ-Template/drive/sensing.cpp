@@ -0,0 +1,151 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// Samples every drive motor, this runs at the start of every tick in ez_auto_task
+void Drive::sensors_iterate() {
+  imu_accel_fresh = false;
+  side_sensor_iterate(left_motors, sensor_left, "Left");
+  side_sensor_iterate(right_motors, sensor_right, "Right");
+}
+
+void Drive::side_sensor_iterate(std::vector<pros::Motor>& motors, side_sensor_& side, const char* name) {
+  if (side.reset_requested.exchange(false)) side_sensor_reset(motors, side);
+  if (side.last.size() != motors.size()) {
+    side.last.assign(motors.size(), NAN);
+    side.strikes.assign(motors.size(), 0);
+    side.failed = 0;
+  }
+
+  // Failures are worked out in a copy and published once at the end of the tick
+  std::uint32_t failed = side.failed.load();
+
+  // Find how far each motor moved since last tick.  Unplugged and pto'd motors don't have a reading
+  std::uint32_t active = pto_active.load();
+  std::vector<double> positions(motors.size(), NAN);
+  std::vector<double> deltas;
+  for (int i = 0; i < motors.size(); i++) {
+    if (active & pto_bit(motors[i].get_port())) {
+      side.last[i] = NAN;
+      continue;
+    }
+    double current = motors[i].get_position();
+    if (current == PROS_ERR_F || std::isnan(current)) {
+      side.last[i] = NAN;
+      if (!(failed & pto_bit(motors[i].get_port()))) {
+        failed |= pto_bit(motors[i].get_port());
+        side.strikes[i] = sensor_strike_limit;
+        printf("%s drive motor on port %i is unplugged!  Using the rest of the %s side.\n", name, abs(motors[i].get_port()), name);
+      }
+      continue;
+    }
+    positions[i] = current;
+    if (!std::isnan(side.last[i])) deltas.push_back(current - side.last[i]);
+  }
+
+  // The first reading starts from where the motors are, after that only changes are added
+  if (side.first) {
+    std::vector<double> valid;
+    for (auto i : positions)
+      if (!std::isnan(i)) valid.push_back(i);
+    if (!valid.empty()) {
+      std::nth_element(valid.begin(), valid.begin() + valid.size() / 2, valid.end());
+      side.position = valid[valid.size() / 2];
+      side.first = false;
+    }
+  }
+
+  // Motors that disagree with the median are outliers.  With 2 motors there is no way to tell which one is wrong
+  double median = 0.0;
+  if (!deltas.empty()) {
+    std::nth_element(deltas.begin(), deltas.begin() + deltas.size() / 2, deltas.end());
+    median = deltas[deltas.size() / 2];
+  }
+  bool can_reject = deltas.size() >= 3;
+  double tolerance = (fabs(median) * 0.5) + 1.0;
+
+  // Average every motor that agrees, motors fail after disagreeing for a while and come back once they agree again
+  double sum = 0.0;
+  int used = 0;
+  for (int i = 0; i < motors.size(); i++) {
+    if (std::isnan(positions[i])) continue;
+    if (std::isnan(side.last[i])) {
+      side.last[i] = positions[i];
+      continue;
+    }
+
+    double delta = positions[i] - side.last[i];
+    side.last[i] = positions[i];
+    bool outlier = can_reject && fabs(delta - median) > tolerance;
+    side.strikes[i] = util::clamp(side.strikes[i] + (outlier ? 1 : -1), sensor_strike_limit, 0);
+
+    std::uint32_t bit = pto_bit(motors[i].get_port());
+    if (!(failed & bit) && side.strikes[i] >= sensor_strike_limit) {
+      failed |= bit;
+      printf("%s drive motor on port %i disagrees with the rest!  Using the rest of the %s side.\n", name, abs(motors[i].get_port()), name);
+    } else if ((failed & bit) && side.strikes[i] == 0) {
+      failed &= ~bit;
+      printf("%s drive motor on port %i is working again.\n", name, abs(motors[i].get_port()));
+    }
+
+    if ((failed & bit) || outlier) continue;
+    sum += delta;
+    used++;
+  }
+  side.failed = failed;
+
+  // With nothing left to read, the side holds its last position
+  if (used != 0) side.position = side.position + (sum / used);
+}
+
+// Ask ez_auto_task to reset both sides at the start of its next tick, so a tare can't land in the middle of a reading
+void Drive::sensors_reset() {
+  if (command_on_task()) {
+    side_sensor_reset(left_motors, sensor_left);
+    side_sensor_reset(right_motors, sensor_right);
+    return;
+  }
+
+  sensor_left.reset_requested = true;
+  sensor_right.reset_requested = true;
+  while (sensor_left.reset_requested.load() || sensor_right.reset_requested.load())
+    pid_tick_wait();
+}
+
+// Tare every motor and start the fused position over from 0, this only runs in ez_auto_task
+void Drive::side_sensor_reset(std::vector<pros::Motor>& motors, side_sensor_& side) {
+  for (auto& i : motors) i.tare_position();
+  side.last.assign(motors.size(), NAN);
+  side.position = 0.0;
+  side.first = false;
+}
+
+// The first motor that is still working, or the first motor if they've all failed
+pros::Motor& Drive::side_motor_get(std::vector<pros::Motor>& motors, side_sensor_& side) {
+  std::uint32_t skip = side.failed.load() | pto_active.load();
+  for (auto& i : motors) {
+    if (!(skip & pto_bit(i.get_port()))) return i;
+  }
+  return motors.front();
+}
+
+std::vector<int> Drive::drive_motors_failed_get() {
+  std::vector<int> output;
+  std::uint32_t left = sensor_left.failed.load();
+  std::uint32_t right = sensor_right.failed.load();
+  for (auto& i : left_motors)
+    if (left & pto_bit(i.get_port())) output.push_back(i.get_port());
+  for (auto& i : right_motors)
+    if (right & pto_bit(i.get_port())) output.push_back(i.get_port());
+  return output;
+}
@@ -64,6 +64,12 @@ void Drive::drive_angle_set(okapi::QAngle p_angle) {
 PID::Constants Drive::pid_heading_constants_get() { return headingPID.constants_get(); }
 PID::Constants Drive::pid_drive_constants_backward_get() { return backward_drivePID.constants_get(); }
 PID::Constants Drive::pid_drive_constants_forward_get() { return forward_drivePID.constants_get(); }
+void Drive::pid_drive_gain_schedule_set(e_gain_schedule key, std::vector<PID::gain_point> table) {
+  motion_config([this, key, table]() {
+    leftPID.gain_schedule_set(key, table);
+    rightPID.gain_schedule_set(key, table);
+  });
+}
 PID::Constants Drive::pid_drive_constants_get() {
   auto fwd_const = pid_drive_constants_forward_get();
   auto rev_const = pid_drive_constants_backward_get();
@@ -79,85 +85,87 @@ PID::Constants Drive::pid_drive_constants_get() {
 /////
 
 // Set pid using global slew
-void Drive::pid_drive_set(double target, int speed) {
+motion_handle Drive::pid_drive_set(double target, int speed) {
   bool slew_on = util::sgn(target) >= 0 ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_drive_set(target, speed, slew_on);
+  return pid_drive_set(target, speed, slew_on);
 }
 
 // Set drive PID
-void Drive::pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading) {
+motion_handle Drive::pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading) {
   double target = p_target.convert(okapi::inch);  // Convert okapi unit to inches
-  pid_drive_set(target, speed, slew_on, toggle_heading);
+  return pid_drive_set(target, speed, slew_on, toggle_heading);
 }
 
 // Set drive PID with global slew and okapi units
-void Drive::pid_drive_set(okapi::QLength p_target, int speed) {
+motion_handle Drive::pid_drive_set(okapi::QLength p_target, int speed) {
   double target = p_target.convert(okapi::inch);  // Convert okapi unit to inches
-  pid_drive_set(target, speed);
+  return pid_drive_set(target, speed);
 }
 
 // Set drive PID raw
-void Drive::pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading) {
-  leftPID.timers_reset();
-  rightPID.timers_reset();
-
-  // Print targets
-  if (print_toggle) printf("Drive Started... Target Value: %.2f", target);
-  if (slew_on && print_toggle) printf(" with slew");
-  if (print_toggle) printf("\n");
-  chain_target_start = target;
-  chain_sensor_start = drive_sensor_left();
-  used_motion_chain_scale = 0.0;
-
-  // Global setup
-  pid_speed_max_set(speed);
-  heading_on = toggle_heading;
-  l_start = drive_sensor_left();
-  r_start = drive_sensor_right();
-
-  double l_target_encoder, r_target_encoder;
-
-  // Figure actual target value
-  l_target_encoder = l_start + target;
-  r_target_encoder = r_start + target;
-
-  PID *new_drive_pid;
-  slew::Constants slew_consts;
-
-  // Figure out if going forward or backward and set constants accordingly
-  if (l_target_encoder < l_start && r_target_encoder < r_start) {
-    new_drive_pid = &backward_drivePID;
-    slew_consts = slew_backward.constants_get();
-    motion_chain_backward = true;
-  } else {
-    new_drive_pid = &forward_drivePID;
-    slew_consts = slew_forward.constants_get();
-    motion_chain_backward = false;
-  }
-
-  // Prioritize custom fwd/rev constants.  Otherwise, use the same for fwd and rev
-  if (fwd_rev_drivePID.constants_set_check() && !new_drive_pid->constants_set_check())
-    new_drive_pid = &fwd_rev_drivePID;
-
-  PID::Constants pid_drive_consts = new_drive_pid->constants_get();
-  leftPID.constants_set(pid_drive_consts.kp, pid_drive_consts.ki, pid_drive_consts.kd, pid_drive_consts.start_i);
-  rightPID.constants_set(pid_drive_consts.kp, pid_drive_consts.ki, pid_drive_consts.kd, pid_drive_consts.start_i);
-  slew_left.constants_set(slew_consts.distance_to_travel, slew_consts.min_speed);
-  slew_right.constants_set(slew_consts.distance_to_travel, slew_consts.min_speed);
-
-  // Set PID targets
-  leftPID.target_set(l_target_encoder);
-  rightPID.target_set(r_target_encoder);
-
-  // Initialize slew
-  slew_left.initialize(slew_on, max_speed, l_target_encoder, drive_sensor_left());
-  slew_right.initialize(slew_on, max_speed, r_target_encoder, drive_sensor_right());
-  current_slew_on = slew_on;
-
-  // Make sure we're using normal PID
-  leftPID.exit = internal_leftPID.exit;
-  rightPID.exit = internal_rightPID.exit;
-
-  // Run task
-  drive_mode_set(DRIVE);
+motion_handle Drive::pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading) {
+  return motion_command([=, this] {
+    leftPID.timers_reset();
+    rightPID.timers_reset();
+
+    // Print targets
+    if (print_toggle) printf("Drive Started... Target Value: %.2f", target);
+    if (slew_on && print_toggle) printf(" with slew");
+    if (print_toggle) printf("\n");
+    chain_target_start = target;
+    chain_sensor_start = drive_sensor_left();
+    used_motion_chain_scale = 0.0;
+
+    // Global setup
+    pid_speed_max_set(speed);
+    heading_on = toggle_heading;
+    l_start = drive_sensor_left();
+    r_start = drive_sensor_right();
+
+    double l_target_encoder, r_target_encoder;
+
+    // Figure actual target value
+    l_target_encoder = l_start + target;
+    r_target_encoder = r_start + target;
+
+    PID *new_drive_pid;
+    slew::Constants slew_consts;
+
+    // Figure out if going forward or backward and set constants accordingly
+    if (l_target_encoder < l_start && r_target_encoder < r_start) {
+      new_drive_pid = &backward_drivePID;
+      slew_consts = slew_backward.constants_get();
+      motion_chain_backward = true;
+    } else {
+      new_drive_pid = &forward_drivePID;
+      slew_consts = slew_forward.constants_get();
+      motion_chain_backward = false;
+    }
+
+    // Prioritize custom fwd/rev constants.  Otherwise, use the same for fwd and rev
+    if (fwd_rev_drivePID.constants_set_check() && !new_drive_pid->constants_set_check())
+      new_drive_pid = &fwd_rev_drivePID;
+
+    PID::Constants pid_drive_consts = new_drive_pid->constants_get();
+    leftPID.constants_set(pid_drive_consts.kp, pid_drive_consts.ki, pid_drive_consts.kd, pid_drive_consts.start_i);
+    rightPID.constants_set(pid_drive_consts.kp, pid_drive_consts.ki, pid_drive_consts.kd, pid_drive_consts.start_i);
+    slew_left.constants_set(slew_consts.distance_to_travel, slew_consts.min_speed);
+    slew_right.constants_set(slew_consts.distance_to_travel, slew_consts.min_speed);
+
+    // Set PID targets
+    leftPID.target_set(l_target_encoder);
+    rightPID.target_set(r_target_encoder);
+
+    // Initialize slew
+    slew_left.initialize(slew_on, max_speed, l_target_encoder, drive_sensor_left());
+    slew_right.initialize(slew_on, max_speed, r_target_encoder, drive_sensor_right());
+    current_slew_on = slew_on;
+
+    // Make sure we're using normal PID
+    leftPID.exit = internal_leftPID.exit;
+    rightPID.exit = internal_rightPID.exit;
+
+    // Run task
+    drive_mode_set(DRIVE);
+  });
 }
\ No newline at end of file
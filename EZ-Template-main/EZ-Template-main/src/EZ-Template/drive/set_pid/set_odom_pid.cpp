@@ -90,273 +90,286 @@ bool Drive::slew_odom_reenabled() { return slew_reenables_when_max_speed_changes
 /////
 // pid_odom_set but it looks like pid_drive_set
 /////
-void Drive::pid_odom_set(okapi::QLength p_target, int speed, bool slew_on) {
+motion_handle Drive::pid_odom_set(okapi::QLength p_target, int speed, bool slew_on) {
   double target = p_target.convert(okapi::inch);
-  pid_odom_set(target, speed, slew_on);
+  return pid_odom_set(target, speed, slew_on);
 }
-void Drive::pid_odom_set(okapi::QLength p_target, int speed) {
+motion_handle Drive::pid_odom_set(okapi::QLength p_target, int speed) {
   double target = p_target.convert(okapi::inch);
-  pid_odom_set(target, speed);
+  return pid_odom_set(target, speed);
 }
-void Drive::pid_odom_set(double target, int speed) {
+motion_handle Drive::pid_odom_set(double target, int speed) {
   bool slew_on = util::sgn(target) >= 0 ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_set(target, speed, slew_on);
-}
-void Drive::pid_odom_set(double target, int speed, bool slew_on) {
-  drive_directions fwd_or_rev = util::sgn(target) >= 0 ? fwd : rev;
-  pose target_pose = util::vector_off_point(target, {odom_x_get(), odom_y_get(), headingPID.target_get()});
-  odom path = {{target_pose.x, target_pose.y}, fwd_or_rev, speed};
-
-  xyPID.timers_reset();
-  current_a_odomPID.timers_reset();
-
-  if (print_toggle) printf("Injected ");
-  std::vector<odom> input_path = inject_points({path});
-  odom_turn_bias_enable(false);
-  current_slew_on = slew_on;
-  slew_min_when_it_enabled = 0;
-  slew_will_enable_later = false;
-  raw_pid_odom_pp_set(input_path, slew_on);
+  return pid_odom_set(target, speed, slew_on);
+}
+motion_handle Drive::pid_odom_set(double target, int speed, bool slew_on) {
+  return motion_command([=, this] {
+    drive_directions fwd_or_rev = util::sgn(target) >= 0 ? fwd : rev;
+    pose target_pose = util::vector_off_point(target, {odom_x_get(), odom_y_get(), headingPID.target_get()});
+    odom path = {{target_pose.x, target_pose.y}, fwd_or_rev, speed};
+
+    xyPID.timers_reset();
+    current_a_odomPID.timers_reset();
+
+    if (print_toggle) printf("Injected ");
+    std::vector<odom> input_path = inject_points({path});
+    odom_turn_bias_enable(false);
+    current_slew_on = slew_on;
+    slew_min_when_it_enabled = 0;
+    slew_will_enable_later = false;
+    raw_pid_odom_pp_set(input_path, slew_on);
+  });
 }
 
 /////
 // pid_odom_set
 /////
 // No units
-void Drive::pid_odom_set(odom imovement) {
+motion_handle Drive::pid_odom_set(odom imovement) {
   bool slew_on = imovement.drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_set(imovement, slew_on);
+  return pid_odom_set(imovement, slew_on);
 }
-void Drive::pid_odom_set(odom imovement, bool slew_on) {
+motion_handle Drive::pid_odom_set(odom imovement, bool slew_on) {
   if (imovement.target.theta != ANGLE_NOT_SET)
-    pid_odom_boomerang_set(imovement, slew_on);
+    return pid_odom_boomerang_set(imovement, slew_on);
   else
-    pid_odom_injected_pp_set({imovement}, slew_on);
+    return pid_odom_injected_pp_set({imovement}, slew_on);
 }
-void Drive::pid_odom_set(std::vector<odom> imovements) {
+motion_handle Drive::pid_odom_set(std::vector<odom> imovements) {
   bool slew_on = imovements[0].drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_set(imovements, slew_on);
+  return pid_odom_set(imovements, slew_on);
 }
-void Drive::pid_odom_set(std::vector<odom> imovements, bool slew_on) {
-  pid_odom_smooth_pp_set(imovements, slew_on);
+motion_handle Drive::pid_odom_set(std::vector<odom> imovements, bool slew_on) {
+  return pid_odom_smooth_pp_set(imovements, slew_on);
 }
 // Units
-void Drive::pid_odom_set(united_odom p_imovement) {
+motion_handle Drive::pid_odom_set(united_odom p_imovement) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_set(imovement);
+  return pid_odom_set(imovement);
 }
-void Drive::pid_odom_set(united_odom p_imovement, bool slew_on) {
+motion_handle Drive::pid_odom_set(united_odom p_imovement, bool slew_on) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_set(imovement, slew_on);
+  return pid_odom_set(imovement, slew_on);
 }
-void Drive::pid_odom_set(std::vector<united_odom> p_imovements) {
+motion_handle Drive::pid_odom_set(std::vector<united_odom> p_imovements) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_set(imovements);
+  return pid_odom_set(imovements);
 }
-void Drive::pid_odom_set(std::vector<united_odom> p_imovements, bool slew_on) {
+motion_handle Drive::pid_odom_set(std::vector<united_odom> p_imovements, bool slew_on) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_set(imovements, slew_on);
+  return pid_odom_set(imovements, slew_on);
 }
 
 /////
 // ptp
 /////
 // No units
-void Drive::pid_odom_ptp_set(odom imovement) {
+motion_handle Drive::pid_odom_ptp_set(odom imovement) {
   bool slew_on = imovement.drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_ptp_set(imovement, slew_on);
+  return pid_odom_ptp_set(imovement, slew_on);
 }
 // Units
-void Drive::pid_odom_ptp_set(united_odom p_imovement) {
+motion_handle Drive::pid_odom_ptp_set(united_odom p_imovement) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_ptp_set(imovement);
+  return pid_odom_ptp_set(imovement);
 }
-void Drive::pid_odom_ptp_set(united_odom p_imovement, bool slew_on) {
+motion_handle Drive::pid_odom_ptp_set(united_odom p_imovement, bool slew_on) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_ptp_set(imovement, slew_on);
+  return pid_odom_ptp_set(imovement, slew_on);
 }
 
 /////
 // pp
 /////
 // No units
-void Drive::pid_odom_pp_set(std::vector<odom> imovements) {
+motion_handle Drive::pid_odom_pp_set(std::vector<odom> imovements) {
   bool slew_on = imovements[0].drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_pp_set(imovements, slew_on);
+  return pid_odom_pp_set(imovements, slew_on);
 }
 // Units
-void Drive::pid_odom_pp_set(std::vector<united_odom> p_imovements) {
+motion_handle Drive::pid_odom_pp_set(std::vector<united_odom> p_imovements) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_pp_set(imovements);
+  return pid_odom_pp_set(imovements);
 }
-void Drive::pid_odom_pp_set(std::vector<united_odom> p_imovements, bool slew_on) {
+motion_handle Drive::pid_odom_pp_set(std::vector<united_odom> p_imovements, bool slew_on) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_pp_set(imovements, slew_on);
+  return pid_odom_pp_set(imovements, slew_on);
 }
 
 /////
 // injected pp
 /////
 // No units
-void Drive::pid_odom_injected_pp_set(std::vector<ez::odom> imovements) {
+motion_handle Drive::pid_odom_injected_pp_set(std::vector<ez::odom> imovements) {
   bool slew_on = imovements[0].drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_injected_pp_set(imovements, slew_on);
-}
-void Drive::pid_odom_injected_pp_set(std::vector<ez::odom> imovements, bool slew_on) {
-  xyPID.timers_reset();
-  current_a_odomPID.timers_reset();
-
-  if (print_toggle) printf("Injected ");
-  std::vector<odom> input_path = inject_points(set_odoms_direction(imovements));
-  odom_turn_bias_enable(true);
-  current_slew_on = slew_on;
-  slew_min_when_it_enabled = 0;
-  slew_will_enable_later = false;
-  raw_pid_odom_pp_set(input_path, slew_on);
+  return pid_odom_injected_pp_set(imovements, slew_on);
+}
+motion_handle Drive::pid_odom_injected_pp_set(std::vector<ez::odom> imovements, bool slew_on) {
+  return motion_command([=, this] {
+    xyPID.timers_reset();
+    current_a_odomPID.timers_reset();
+
+    if (print_toggle) printf("Injected ");
+    std::vector<odom> input_path = inject_points(set_odoms_direction(imovements));
+    odom_turn_bias_enable(true);
+    current_slew_on = slew_on;
+    slew_min_when_it_enabled = 0;
+    slew_will_enable_later = false;
+    raw_pid_odom_pp_set(input_path, slew_on);
+  });
 }
 // Units
-void Drive::pid_odom_injected_pp_set(std::vector<ez::united_odom> p_imovements) {
+motion_handle Drive::pid_odom_injected_pp_set(std::vector<ez::united_odom> p_imovements) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_injected_pp_set(imovements);
+  return pid_odom_injected_pp_set(imovements);
 }
-void Drive::pid_odom_injected_pp_set(std::vector<ez::united_odom> p_imovements, bool slew_on) {
+motion_handle Drive::pid_odom_injected_pp_set(std::vector<ez::united_odom> p_imovements, bool slew_on) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_injected_pp_set(imovements, slew_on);
+  return pid_odom_injected_pp_set(imovements, slew_on);
 }
 
 /////
 // smooth injected pp
 /////
 // No units
-void Drive::pid_odom_smooth_pp_set(std::vector<odom> imovements) {
+motion_handle Drive::pid_odom_smooth_pp_set(std::vector<odom> imovements) {
   bool slew_on = imovements[0].drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_smooth_pp_set(imovements, slew_on);
-}
-void Drive::pid_odom_smooth_pp_set(std::vector<odom> imovements, bool slew_on) {
-  xyPID.timers_reset();
-  current_a_odomPID.timers_reset();
-
-  if (print_toggle) printf("Smooth Injected ");
-  std::vector<odom> input_path = smooth_path(inject_points(set_odoms_direction(imovements)), odom_smooth_weight_smooth, odom_smooth_weight_data, odom_smooth_tolerance);
-  odom_turn_bias_enable(true);
-  current_slew_on = slew_on;
-  slew_min_when_it_enabled = 0;
-  slew_will_enable_later = false;
-  raw_pid_odom_pp_set(input_path, slew_on);
+  return pid_odom_smooth_pp_set(imovements, slew_on);
+}
+motion_handle Drive::pid_odom_smooth_pp_set(std::vector<odom> imovements, bool slew_on) {
+  return motion_command([=, this] {
+    xyPID.timers_reset();
+    current_a_odomPID.timers_reset();
+
+    if (print_toggle) printf("Smooth Injected ");
+    std::vector<odom> input_path = smooth_path(inject_points(set_odoms_direction(imovements)), odom_smooth_weight_smooth, odom_smooth_weight_data, odom_smooth_tolerance);
+    odom_turn_bias_enable(true);
+    current_slew_on = slew_on;
+    slew_min_when_it_enabled = 0;
+    slew_will_enable_later = false;
+    raw_pid_odom_pp_set(input_path, slew_on);
+  });
 }
 // Units
-void Drive::pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements) {
+motion_handle Drive::pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_smooth_pp_set(imovements);
+  return pid_odom_smooth_pp_set(imovements);
 }
-void Drive::pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements, bool slew_on) {
+motion_handle Drive::pid_odom_smooth_pp_set(std::vector<united_odom> p_imovements, bool slew_on) {
   std::vector<odom> imovements = util::united_odoms_to_odoms(p_imovements);
-  pid_odom_smooth_pp_set(imovements, slew_on);
+  return pid_odom_smooth_pp_set(imovements, slew_on);
 }
 
 /////
 // boomerang
 /////
 // No units
-void Drive::pid_odom_boomerang_set(odom imovement) {
+motion_handle Drive::pid_odom_boomerang_set(odom imovement) {
   bool slew_on = imovement.drive_direction == fwd ? slew_drive_forward_get() : slew_drive_backward_get();
-  pid_odom_boomerang_set(imovement, slew_on);
+  return pid_odom_boomerang_set(imovement, slew_on);
 }
-void Drive::pid_odom_boomerang_set(odom imovement, bool slew_on) {
-  if (print_toggle) printf("Boomerang ");
-  pid_odom_pp_set({imovement}, slew_on);
+motion_handle Drive::pid_odom_boomerang_set(odom imovement, bool slew_on) {
+  return motion_command([=, this] {
+    if (print_toggle) printf("Boomerang ");
+    pid_odom_pp_set({imovement}, slew_on);
+  });
 }
 // Units
-void Drive::pid_odom_boomerang_set(united_odom p_imovement) {
+motion_handle Drive::pid_odom_boomerang_set(united_odom p_imovement) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_boomerang_set(imovement);
+  return pid_odom_boomerang_set(imovement);
 }
-void Drive::pid_odom_boomerang_set(united_odom p_imovement, bool slew_on) {
+motion_handle Drive::pid_odom_boomerang_set(united_odom p_imovement, bool slew_on) {
   odom imovement = util::united_odom_to_odom(p_imovement);
-  pid_odom_boomerang_set(imovement, slew_on);
+  return pid_odom_boomerang_set(imovement, slew_on);
 }
 
 /////
 // External base pure pursuit
 /////
-void Drive::pid_odom_pp_set(std::vector<odom> imovements, bool slew_on) {
-  xyPID.timers_reset();
-  current_a_odomPID.timers_reset();
-
-  std::vector<odom> input = set_odoms_direction(imovements);
-  input.insert(input.begin(), {{{odom_x_get(), odom_y_get(), ANGLE_NOT_SET}, imovements[0].drive_direction, imovements[0].max_xy_speed}});
-
-  int t = 0;
-  for (int i = 0; i < input.size() - 1; i++) {
-    // Inject new parent points for boomerang
-    int j = i + t;
-    j = i;
-    if (input[j].target.theta != ANGLE_NOT_SET) {
-      // Calculate the new point with known information: hypot and angle
-      double angle_to_point = input[j].target.theta;
-      int dir = input[j].drive_direction == REV ? -1 : 1;
-      pose new_point = util::vector_off_point(odom_look_ahead_get() * dir, {input[j].target.x, input[j].target.y, angle_to_point});
-      new_point.theta = ANGLE_NOT_SET;
-
-      input.insert(input.cbegin() + j + 1, {new_point, input[j].drive_direction, input[j].max_xy_speed});
-
-      t++;
+motion_handle Drive::pid_odom_pp_set(std::vector<odom> imovements, bool slew_on) {
+  return motion_command([=, this] {
+    xyPID.timers_reset();
+    current_a_odomPID.timers_reset();
+
+    std::vector<odom> input = set_odoms_direction(imovements);
+    input.insert(input.begin(), {{{odom_x_get(), odom_y_get(), ANGLE_NOT_SET}, imovements[0].drive_direction, imovements[0].max_xy_speed}});
+
+    int t = 0;
+    for (int i = 0; i < input.size() - 1; i++) {
+      // Inject new parent points for boomerang
+      int j = i + t;
+      j = i;
+      if (input[j].target.theta != ANGLE_NOT_SET) {
+        // Calculate the new point with known information: hypot and angle
+        double angle_to_point = input[j].target.theta;
+        int dir = input[j].drive_direction == REV ? -1 : 1;
+        pose new_point = util::vector_off_point(odom_look_ahead_get() * dir, {input[j].target.x, input[j].target.y, angle_to_point});
+        new_point.theta = ANGLE_NOT_SET;
+
+        input.insert(input.cbegin() + j + 1, {new_point, input[j].drive_direction, input[j].max_xy_speed});
+
+        t++;
+      }
     }
-  }
 
-  // Shift all the turn behaviors 1 parent point down
-  for (int i = 0; i < input.size() - 1; i++) {
-    input[i].turn_behavior = input[i + 1].turn_behavior;
-  }
-  input.back().turn_behavior = raw;
-
-  // This is used for pid_wait_until_pp()
-  injected_pp_index.clear();
-  injected_pp_index.push_back(0);
-  for (int i = 0; i < input.size(); i++) {
-    if (i != 0 && input[i - 1].target.theta == ANGLE_NOT_SET)
-      injected_pp_index.push_back(i);
-  }
+    // Shift all the turn behaviors 1 parent point down
+    for (int i = 0; i < input.size() - 1; i++) {
+      input[i].turn_behavior = input[i + 1].turn_behavior;
+    }
+    input.back().turn_behavior = raw;
+
+    // This is used for pid_wait_until_pp()
+    injected_pp_index.clear();
+    injected_pp_index.push_back(0);
+    for (int i = 0; i < input.size(); i++) {
+      if (i != 0 && input[i - 1].target.theta == ANGLE_NOT_SET)
+        injected_pp_index.push_back(i);
+    }
 
-  odom_turn_bias_enable(true);
-  current_slew_on = slew_on;
-  slew_min_when_it_enabled = 0;
-  slew_will_enable_later = false;
+    odom_turn_bias_enable(true);
+    current_slew_on = slew_on;
+    slew_min_when_it_enabled = 0;
+    slew_will_enable_later = false;
 
-  if (print_toggle) printf("Pure Pursuit ");
-  raw_pid_odom_pp_set(input, slew_on);
+    if (print_toggle) printf("Pure Pursuit ");
+    raw_pid_odom_pp_set(input, slew_on);
+  });
 }
 
 //////
 // External base ptp
 /////
-void Drive::pid_odom_ptp_set(odom imovement, bool slew_on) {
-  imovement = set_odom_direction(imovement);
+motion_handle Drive::pid_odom_ptp_set(odom imovement, bool slew_on) {
+  return motion_command([=, this]() mutable {
+    imovement = set_odom_direction(imovement);
+    holonomic_heading = drive_imu_get();
 
-  odom_second_to_last = odom_pose_get();
-  odom_target_start = imovement.target;
-  odom_start = odom_pose_get();
+    odom_second_to_last = odom_pose_get();
+    odom_target_start = imovement.target;
+    odom_start = odom_pose_get();
 
-  xyPID.timers_reset();
-  current_a_odomPID.timers_reset();
+    xyPID.timers_reset();
+    current_a_odomPID.timers_reset();
 
-  // This is used for wait_until and slew
-  l_start = drive_sensor_left();
-  r_start = drive_sensor_right();
+    // This is used for wait_until and slew
+    l_start = drive_sensor_left();
+    r_start = drive_sensor_right();
 
-  odom_turn_bias_enable(true);
-  current_slew_on = slew_on;
-  slew_min_when_it_enabled = 0;
-  slew_will_enable_later = false;
-  raw_pid_odom_ptp_set(imovement, slew_on);
+    odom_turn_bias_enable(true);
+    current_slew_on = slew_on;
+    slew_min_when_it_enabled = 0;
+    slew_will_enable_later = false;
+    raw_pid_odom_ptp_set(imovement, slew_on);
 
-  // Initialize slew
-  int dir = current_drive_direction == REV ? -1 : 1;  // If we're going backwards, add a -1
-  double dist_to_target = util::distance_to_point(odom_target, odom_pose_get()) * dir;
-  slew_left.initialize(slew_on, max_speed, dist_to_target + l_start, l_start);
-  slew_right.initialize(slew_on, max_speed, dist_to_target + r_start, r_start);
+    // Initialize slew
+    int dir = current_drive_direction == REV ? -1 : 1;  // If we're going backwards, add a -1
+    double dist_to_target = util::distance_to_point(odom_target, odom_pose_get()) * dir;
+    slew_left.initialize(slew_on, max_speed, dist_to_target + l_start, l_start);
+    slew_right.initialize(slew_on, max_speed, dist_to_target + r_start, r_start);
 
-  drive_mode_set(POINT_TO_POINT);
+    drive_mode_set(POINT_TO_POINT);
+  });
 }
 
 /////
@@ -368,6 +381,7 @@ void Drive::raw_pid_odom_pp_set(std::vector<odom> imovements, bool slew_on) {
   odom_start = odom_pose_get();
 
   was_last_pp_mode_boomerang = false;
+  holonomic_heading = drive_imu_get();
 
   // Clear current list of targets
   pp_movements.clear();
@@ -397,7 +411,6 @@ void Drive::raw_pid_odom_pp_set(std::vector<odom> imovements, bool slew_on) {
 void Drive::raw_pid_odom_ptp_set(odom imovement, bool slew_on) {
   // Update current drive/turn behavior
   current_drive_direction = imovement.drive_direction;
-
   // Calculate the point to look at
   point_to_face = find_point_to_face(odom_pose_get(), {imovement.target.x, imovement.target.y}, current_drive_direction, true);
   double target = util::absolute_angle_to_point(point_to_face[!ptf1_running], odom_pose_get());  // Calculate the point for angle to face
@@ -406,6 +419,10 @@ void Drive::raw_pid_odom_ptp_set(odom imovement, bool slew_on) {
     current_angle_behavior = imovement.turn_behavior;
   }
 
+  // Holonomic drives turn to the angle of a point while driving to it
+  if (imovement.target.theta != ANGLE_NOT_SET)
+    holonomic_heading = new_turn_target_compute(imovement.target.theta, drive_imu_get(), current_angle_behavior);
+
   if (current_slew_on && imovement.max_xy_speed > pid_speed_max_get() && slew_odom_reenabled()) {
     slew_will_enable_later = true;
   }
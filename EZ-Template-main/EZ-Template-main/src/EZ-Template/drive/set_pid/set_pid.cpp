@@ -61,6 +61,15 @@ void Drive::pid_targets_reset() {
 }
 
 void Drive::drive_mode_set(e_mode p_mode, bool stop_drive) {
+  // Setting the mode directly replaces any command that hasn't started yet
+  if (!command_on_task()) command_drop();
+
+  // Every new motion gets a new id, and disabling cancels whatever was running
+  if (p_mode != DISABLE)
+    motion_start();
+  else if (mode != DISABLE)
+    motion_finish(motion_id, CANCEL_EXIT);
+
   mode = p_mode;
   if (mode == DISABLE && stop_drive)
     private_drive_set(0, 0);
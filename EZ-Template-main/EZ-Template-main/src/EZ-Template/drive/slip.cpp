@@ -0,0 +1,121 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/tracking_wheel.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+void Drive::drive_slip_detection_set(bool toggle) {
+  if (toggle && is_tracker != DRIVE_INTEGRATED) {
+    printf("Slip detection only works with integrated encoders!\n");
+    return;
+  }
+  slip_enabled = toggle;
+  slip_first = true;
+}
+bool Drive::drive_slip_detection_get() { return slip_enabled; }
+
+void Drive::drive_slip_constants_set(double threshold, double reduction, double recovery, double minimum) {
+  slip_threshold = fabs(threshold);
+  slip_reduction = util::clamp(reduction, 1.0, 0.0);
+  slip_recovery = fabs(recovery);
+  slip_minimum = util::clamp(minimum, 127.0, 0.0);
+}
+
+bool Drive::drive_slip_left_get() { return slip_left; }
+bool Drive::drive_slip_right_get() { return slip_right; }
+
+// Compares what the IMEs say against trackers or the IMU, then limits the side that's slipping
+void Drive::slip_iterate() {
+  if (!slip_enabled || !imu_calibration_complete) {
+    slip_first = true;
+    slip_left = false;
+    slip_right = false;
+    traction_limit_left = 127.0;
+    traction_limit_right = 127.0;
+    return;
+  }
+
+  double l_current = drive_sensor_left();
+  double r_current = drive_sensor_right();
+  double l_tracker = odom_tracker_left_enabled ? odom_tracker_left->get() : 0.0;
+  double r_tracker = odom_tracker_right_enabled ? odom_tracker_right->get() : 0.0;
+  double t_current = -util::to_rad(drive_imu_get());  // negative for math standard, same as tracking
+
+  // Deltas since the last tick
+  double l_ = l_current - slip_last_left;
+  double r_ = r_current - slip_last_right;
+  double l_tracker_ = l_tracker - slip_last_left_tracker;
+  double r_tracker_ = r_tracker - slip_last_right_tracker;
+  double t_ = t_current - slip_last_theta;
+  slip_last_left = l_current;
+  slip_last_right = r_current;
+  slip_last_left_tracker = l_tracker;
+  slip_last_right_tracker = r_tracker;
+  slip_last_theta = t_current;
+
+  double dt = util::DELAY_TIME / 1000.0;
+  if (slip_first) {
+    slip_first = false;
+    slip_ticks = 0;
+    for (auto window : {&slip_left_window, &slip_right_window, &slip_left_expected_window, &slip_right_expected_window,
+                        &slip_center_window, &slip_side_window, &slip_ime_turn_window, &slip_imu_turn_window, &slip_imu_speed_window, &slip_speed_history})
+      window->clear();
+    return;
+  }
+  slip_ticks++;
+  double window_time = slip_window_::size * dt;
+
+  if (odom_tracker_left_enabled || odom_tracker_right_enabled) {
+    // Find how far the center of the robot moved from a tracker, then how far each side should have moved
+    double center = odom_tracker_left_enabled ? l_tracker_ - (odom_tracker_left->distance_to_center_get() * t_) : r_tracker_ - (odom_tracker_right->distance_to_center_get() * t_);
+    slip_left_window.push(l_);
+    slip_right_window.push(r_);
+    slip_left_expected_window.push(center + (odom_ime_track_width_left * t_));
+    slip_right_expected_window.push(center + (odom_ime_track_width_right * t_));
+
+    // Slipping wheels spin faster than the robot is moving
+    bool full = slip_ticks >= slip_window_::size;
+    slip_left = full && (fabs(slip_left_window.sum) - fabs(slip_left_expected_window.sum)) / window_time > slip_threshold;
+    slip_right = full && (fabs(slip_right_window.sum) - fabs(slip_right_expected_window.sum)) / window_time > slip_threshold;
+  } else {
+    // Without trackers, the IMEs can't change speed more than the IMU says the robot did.  Speed is averaged over
+    // the window and compared to what it was a window ago, and the IMU's acceleration is summed over the same time
+    slip_center_window.push((l_ + r_) / 2.0);
+    double speed = slip_center_window.sum / window_time;
+    double speed_change = fabs(speed - slip_speed_history.push(speed));
+    const pros::imu_accel_s_t& accel = imu_accel_tick();
+    slip_imu_speed_window.push(sqrt((accel.x * accel.x) + (accel.y * accel.y)) * 386.09 * dt);  // g to in/s^2, then to in/s this tick
+    bool slipping = slip_ticks >= slip_window_::size * 2 && speed_change - slip_imu_speed_window.sum > slip_threshold;
+    slip_left = slipping;
+    slip_right = slipping;
+
+    // The IMEs also can't turn the robot more than the IMU saw, blame the side that moved more
+    if (global_track_width != 0.0) {
+      slip_ime_turn_window.push((r_ - l_) / global_track_width);
+      slip_imu_turn_window.push(t_);
+      slip_side_window.push(fabs(l_) - fabs(r_));
+      double turn_error = fabs(slip_ime_turn_window.sum - slip_imu_turn_window.sum) * (global_track_width / 2.0);
+      if (slip_ticks >= slip_window_::size && turn_error / window_time > slip_threshold) {
+        if (slip_side_window.sum > 0.0)
+          slip_left = true;
+        else
+          slip_right = true;
+      }
+    }
+  }
+
+  // Cut output while slipping, and let it come back once the wheels grip again.  A side that isn't being powered
+  // can't spin out, and the limit never drops below the minimum so a false reading can't stop the robot
+  auto limit = [this](double current, double last_output, bool slipping) {
+    if (slipping && last_output != 0.0) return fmax(slip_minimum, current * slip_reduction);
+    return fmin(127.0, current + slip_recovery);
+  };
+  traction_limit_left = limit(traction_limit_left, traction_last_left, slip_left);
+  traction_limit_right = limit(traction_limit_right, traction_last_right, slip_right);
+}
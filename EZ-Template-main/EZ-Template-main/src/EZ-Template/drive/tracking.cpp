@@ -78,53 +78,6 @@ std::pair<float, float> Drive::decide_vert_sensor(ez::tracking_wheel* tracker, b
   return {current, track_width};
 }
 
-ez::pose Drive::solve_xy_vert(float p_track_width, float current_t, float delta_vert, float delta_t) {
-  pose output = {0.0, 0.0, 0.0};
-
-  // Figure out how far we've actually moved
-  float local_x = delta_vert;
-  float half_delta_t = 0.0;
-  if (delta_t != 0) {
-    half_delta_t = delta_t / 2.0;
-    float i = sin(half_delta_t) * 2.0;
-    local_x = (delta_vert / delta_t - p_track_width) * i;
-  }
-
-  float alpha = current_t - half_delta_t;
-  float x = cos(alpha) * local_x;
-  float y = sin(alpha) * local_x;
-
-  // xy is calculated internally using math standard but translated to what's intuitive
-  // where going forward from 0 degrees increases Y
-  output.x = -y;
-  output.y = x;
-
-  return output;
-}
-
-ez::pose Drive::solve_xy_horiz(float p_track_width, float current_t, float delta_horiz, float delta_t) {
-  pose output = {0.0, 0.0, 0.0};
-
-  // Figure out how far we've actually moved
-  float local_y = delta_horiz;
-  float half_delta_t = 0.0;
-  if (delta_t != 0) {
-    half_delta_t = delta_t / 2.0;
-    float i = sin(half_delta_t) * 2.0;
-    local_y = (delta_horiz / delta_t + p_track_width) * i;
-  }
-
-  float alpha = current_t - half_delta_t;
-  float x = -sin(alpha) * local_y;
-  float y = cos(alpha) * local_y;
-
-  // xy is calculated internally using math standard but translated to what's intuitive
-  // where going forward from 0 degrees increases Y
-  output.x = -y;
-  output.y = x;
-
-  return output;
-}
 // pose central_pose;
 // Tracking based on https://wiki.purduesigbots.com/software/odometry
 void Drive::ez_tracking_task() {
@@ -142,7 +95,8 @@ void Drive::ez_tracking_task() {
 
   ez::tracking_wheel* h_sensor = odom_tracker_back != nullptr ? odom_tracker_back : odom_tracker_front;
   bool h_tracker_enabled = h_sensor == odom_tracker_back ? odom_tracker_back_enabled : odom_tracker_front_enabled;
-  std::pair<float, float> h_cur_and_track = decide_vert_sensor(h_sensor, h_tracker_enabled);
+  // Holonomic drives can strafe without a horizontal tracker, horizontal sensors are positive to the left
+  std::pair<float, float> h_cur_and_track = decide_vert_sensor(h_sensor, h_tracker_enabled, holonomic ? -drive_sensor_strafe() : 0.0);
   float h_current = h_cur_and_track.first;
   float h_track_width = h_cur_and_track.second;
   // Calculate velocity based on horiz value
@@ -170,29 +124,18 @@ void Drive::ez_tracking_task() {
   float t_ = t_current - t_last;
   t_last = t_current;
 
-  pose h_pose_ = solve_xy_horiz(h_track_width, t_current, h_, t_);
-  pose l_pose_ = solve_xy_vert(l_track_width, t_current, l_, t_);
-  pose r_pose_ = solve_xy_vert(r_track_width, t_current, r_, t_);
-
-  r_pose.x += r_pose_.x;
-  r_pose.y += r_pose_.y;
-  r_pose.x += h_pose_.x;
-  r_pose.y += h_pose_.y;
-
-  l_pose.x += l_pose_.x;
-  l_pose.y += l_pose_.y;
-  l_pose.x += h_pose_.x;
-  l_pose.y += h_pose_.y;
-
-  // Track width of 0, but the delta is avg of l+r
-  double avg = l_ + r_;
-  if (avg != 0.0)
-    avg /= 2.0;
-  pose central_pose_ = solve_xy_vert(0.0, t_current, avg, t_);
-  central_pose.x += central_pose_.x;
-  central_pose.y += central_pose_.y;
-  central_pose.x += h_pose_.x;
-  central_pose.y += h_pose_.y;
+  // Left, right, and central with a track width of 0 where the delta is the avg of l+r
+  float deltas[util::ODOM_HYPOTHESES] = {l_, r_, (l_ + r_) / 2.0f};
+  float widths[util::ODOM_HYPOTHESES] = {l_track_width, r_track_width, 0.0f};
+  float x_[util::ODOM_HYPOTHESES], y_[util::ODOM_HYPOTHESES];
+  util::odom_solve_xy(t_current, t_, h_, h_track_width, deltas, widths, x_, y_);
+
+  l_pose.x += x_[0];
+  l_pose.y += y_[0];
+  r_pose.x += x_[1];
+  r_pose.y += y_[1];
+  central_pose.x += x_[2];
+  central_pose.y += y_[2];
 
   odom_current.x = central_pose.x;
   odom_current.y = central_pose.y;
@@ -0,0 +1,176 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// Reserve a trigger slot for the current motion, reusing slots that finished on an older motion
+Drive::trigger_* Drive::trigger_claim(trigger_kind_ kind, std::function<void()> callback) {
+  motion_command_wait();
+  for (auto& trigger : triggers) {
+    int state = trigger.state.load();
+    bool reusable = state == TRIGGER_FREE || ((state == TRIGGER_FIRED || state == TRIGGER_EXPIRED) && trigger.motion != motion_id);
+    if (reusable && trigger.state.compare_exchange_strong(state, TRIGGER_CLAIMED)) {
+      trigger.id = ++trigger_id;
+      trigger.motion = motion_id;
+      trigger.kind = kind;
+      trigger.callback = callback;
+      return &trigger;
+    }
+  }
+
+  printf("Trigger Error!  All %i triggers are in use!\n", (int)triggers.size());
+  return nullptr;
+}
+
+// Hand a filled in trigger over to ez_auto_task
+int Drive::trigger_arm(trigger_* trigger) {
+  triggers_armed++;
+  trigger->state.store(TRIGGER_ARMED);
+  return trigger->id;
+}
+
+// Distance
+int Drive::pid_trigger_distance_add(double target, std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_DISTANCE, callback);
+  if (trigger == nullptr) return -1;
+
+  trigger->value = l_start + target;
+  trigger->value_right = r_start + target;
+  trigger->sgn = util::sgn(trigger->value - drive_sensor_left());
+  trigger->sgn_right = util::sgn(trigger->value_right - drive_sensor_right());
+  return trigger_arm(trigger);
+}
+int Drive::pid_trigger_distance_add(okapi::QLength p_target, std::function<void()> callback) { return pid_trigger_distance_add(p_target.convert(okapi::inch), callback); }
+
+// Angle
+int Drive::pid_trigger_angle_add(double target, std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_ANGLE, callback);
+  if (trigger == nullptr) return -1;
+
+  // Create new target that is the shortest from current
+  trigger->value = new_turn_target_compute(target, drive_imu_get(), shortest);
+  trigger->sgn = util::sgn(trigger->value - drive_imu_get());
+  return trigger_arm(trigger);
+}
+int Drive::pid_trigger_angle_add(okapi::QAngle p_target, std::function<void()> callback) { return pid_trigger_angle_add(p_target.convert(okapi::degree), callback); }
+
+// Pure pursuit index
+int Drive::pid_trigger_index_add(int index, std::function<void()> callback) {
+  motion_command_wait();
+  if (index > (int)injected_pp_index.size() - 2 || index < 0) {
+    printf("Trigger Error!  Index %i is not within range!  %i is max!\n", index, (int)injected_pp_index.size() - 2);
+    return -1;
+  }
+
+  trigger_* trigger = trigger_claim(TRIGGER_INDEX, callback);
+  if (trigger == nullptr) return -1;
+
+  trigger->value = injected_pp_index[index + 1];
+  return trigger_arm(trigger);
+}
+
+// Passing a point
+int Drive::pid_trigger_point_add(pose target, std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_POINT, callback);
+  if (trigger == nullptr) return -1;
+
+  trigger->target = target;
+  trigger->sgn = util::sgn(is_past_target(target, odom_pose_get()));
+  return trigger_arm(trigger);
+}
+int Drive::pid_trigger_point_add(united_pose p_target, std::function<void()> callback) { return pid_trigger_point_add(util::united_pose_to_pose(p_target), callback); }
+
+// Getting close to a point
+int Drive::pid_trigger_radius_add(pose target, double radius, std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_RADIUS, callback);
+  if (trigger == nullptr) return -1;
+
+  trigger->target = target;
+  trigger->value = fabs(radius);
+  return trigger_arm(trigger);
+}
+int Drive::pid_trigger_radius_add(united_pose p_target, okapi::QLength p_radius, std::function<void()> callback) {
+  return pid_trigger_radius_add(util::united_pose_to_pose(p_target), p_radius.convert(okapi::inch), callback);
+}
+
+// Exits
+int Drive::pid_trigger_exit_add(std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_EXIT, callback);
+  if (trigger == nullptr) return -1;
+  return trigger_arm(trigger);
+}
+int Drive::pid_trigger_interfered_add(std::function<void()> callback) {
+  trigger_* trigger = trigger_claim(TRIGGER_INTERFERED, callback);
+  if (trigger == nullptr) return -1;
+  return trigger_arm(trigger);
+}
+
+bool Drive::pid_trigger_fired(int id) {
+  for (auto& trigger : triggers) {
+    if (trigger.id == id) return trigger.state.load() == TRIGGER_FIRED;
+  }
+  return false;
+}
+
+void Drive::pid_triggers_clear() {
+  for (auto& trigger : triggers) {
+    int state = trigger.state.load();
+    if (state == TRIGGER_CLAIMED) continue;
+    if (trigger.state.compare_exchange_strong(state, TRIGGER_FREE) && state == TRIGGER_ARMED)
+      triggers_armed--;
+  }
+}
+
+// Returns true when a position based trigger has been reached
+bool Drive::trigger_check(trigger_& trigger) {
+  switch (trigger.kind) {
+    case TRIGGER_DISTANCE:
+      return util::sgn(trigger.value - drive_sensor_left()) != trigger.sgn && util::sgn(trigger.value_right - drive_sensor_right()) != trigger.sgn_right;
+    case TRIGGER_ANGLE:
+      return util::sgn(trigger.value - drive_imu_get()) != trigger.sgn;
+    case TRIGGER_INDEX:
+      return mode == PURE_PURSUIT && pp_index >= trigger.value;
+    case TRIGGER_POINT:
+      return util::sgn(is_past_target(trigger.target, odom_pose_get())) != trigger.sgn;
+    case TRIGGER_RADIUS:
+      return util::distance_to_point(trigger.target, odom_pose_get()) <= trigger.value;
+    default:
+      return false;
+  }
+}
+
+// Checks every armed trigger, this runs once per tick in ez_auto_task after exit conditions
+void Drive::triggers_iterate() {
+  if (triggers_armed.load() == 0) return;
+
+  for (auto& trigger : triggers) {
+    if (trigger.state.load() != TRIGGER_ARMED) continue;
+
+    exit_output exit = motion_exit_get(trigger.motion);
+    bool fire = false;
+    bool expire = false;
+    if (trigger.kind == TRIGGER_EXIT) {
+      fire = exit != RUNNING;
+    } else if (trigger.kind == TRIGGER_INTERFERED) {
+      fire = exit == mA_EXIT || exit == VELOCITY_EXIT;
+      expire = exit != RUNNING && !fire;
+    } else {
+      // Position triggers are dropped once their motion is over
+      expire = exit != RUNNING;
+      fire = !expire && trigger_check(trigger);
+    }
+
+    if (!fire && !expire) continue;
+
+    int armed = TRIGGER_ARMED;
+    if (!trigger.state.compare_exchange_strong(armed, fire ? TRIGGER_FIRED : TRIGGER_EXPIRED)) continue;
+    triggers_armed--;
+    if (fire && trigger.callback) trigger.callback();
+  }
+}
@@ -5,6 +5,8 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 */
 
 #include "EZ-Template/PID.hpp"
+#include "EZ-Template/controller_display.hpp"
+#include "EZ-Template/controller_input.hpp"
 #include "EZ-Template/drive/drive.hpp"
 #include "pros/misc.h"
 
@@ -13,15 +15,30 @@ bool Drive::opcontrol_arcade_scaling_enabled() { return arcade_vector_scaling; }
 
 // Set curve defaults
 void Drive::opcontrol_curve_default_set(double left, double right) {
+  curve_mutex.take();
   left_curve_scale = left;
   right_curve_scale = right;
+  curve_mutex.give();
+  curve_tables_build();
 
   save_l_curve_sd();
   save_r_curve_sd();
 }
 
 std::vector<double> Drive::opcontrol_curve_default_get() {
-  return {left_curve_scale, right_curve_scale};
+  return {left_curves[left_curve_active].scale, right_curves[right_curve_active].scale};
+}
+
+// Reads a curve scale, leaving it alone when the file is empty or doesn't start with a number
+static bool curve_sd_read(FILE* usd_file_read, double* scale) {
+  char buf[16] = {0};
+  fread(buf, 1, sizeof(buf) - 1, usd_file_read);
+  fclose(usd_file_read);
+  char* end;
+  double value = strtod(buf, &end);
+  if (end == buf) return false;
+  *scale = value;
+  return true;
 }
 
 // Initialize curve SD card
@@ -29,13 +46,14 @@ void Drive::opcontrol_curve_sd_initialize() {
   // If no SD card, return
   if (!ez::util::SD_CARD_ACTIVE) return;
 
+  // This runs on the initialize task, so the scales are read into locals and only swapped in once both are known
+  std::vector<double> scales = opcontrol_curve_default_get();
+
   FILE* l_usd_file_read;
   // If file exists...
   if ((l_usd_file_read = fopen("/usd/left_curve.txt", "r"))) {
-    char l_buf[5];
-    fread(l_buf, 1, 5, l_usd_file_read);
-    left_curve_scale = std::stof(l_buf);
-    fclose(l_usd_file_read);
+    if (!curve_sd_read(l_usd_file_read, &scales[0]))
+      printf("left_curve.txt is corrupt, using %.1f\n", scales[0]);
   }
   // If file doesn't exist, create file
   else {
@@ -46,16 +64,20 @@ void Drive::opcontrol_curve_sd_initialize() {
   FILE* r_usd_file_read;
   // If file exists...
   if ((r_usd_file_read = fopen("/usd/right_curve.txt", "r"))) {
-    char l_buf[5];
-    fread(l_buf, 1, 5, r_usd_file_read);
-    right_curve_scale = std::stof(l_buf);
-    fclose(r_usd_file_read);
+    if (!curve_sd_read(r_usd_file_read, &scales[1]))
+      printf("right_curve.txt is corrupt, using %.1f\n", scales[1]);
   }
   // If file doesn't exist, create file
   else {
     save_r_curve_sd();  // Writing to a file that doesn't exist creates the file
     printf("Created right_curve.txt\n");
   }
+
+  curve_mutex.take();
+  left_curve_scale = scales[0];
+  right_curve_scale = scales[1];
+  curve_mutex.give();
+  curve_tables_build();
 }
 
 // Save new left curve to SD card
@@ -64,7 +86,8 @@ void Drive::save_l_curve_sd() {
   if (!ez::util::SD_CARD_ACTIVE) return;
 
   FILE* usd_file_write = fopen("/usd/left_curve.txt", "w");
-  std::string in_str = std::to_string(left_curve_scale);
+  if (usd_file_write == nullptr) return;
+  std::string in_str = std::to_string(left_curves[left_curve_active].scale);
   char const* in_c = in_str.c_str();
   fputs(in_c, usd_file_write);
   fclose(usd_file_write);
@@ -76,7 +99,8 @@ void Drive::save_r_curve_sd() {
   if (!ez::util::SD_CARD_ACTIVE) return;
 
   FILE* usd_file_write = fopen("/usd/right_curve.txt", "w");
-  std::string in_str = std::to_string(right_curve_scale);
+  if (usd_file_write == nullptr) return;
+  std::string in_str = std::to_string(right_curves[right_curve_active].scale);
   char const* in_c = in_str.c_str();
   fputs(in_c, usd_file_write);
   fclose(usd_file_write);
@@ -100,15 +124,31 @@ std::vector<pros::controller_digital_e_t> Drive::opcontrol_curve_buttons_right_g
 }
 
 // Increase / decrease left and right curves
-void Drive::l_increase() { left_curve_scale += 0.1; }
+void Drive::l_increase() {
+  curve_mutex.take();
+  left_curve_scale += 0.1;
+  curve_publish(left_curves, left_curve_active, left_curve_function, left_curve_scale);
+  curve_mutex.give();
+}
 void Drive::l_decrease() {
+  curve_mutex.take();
   left_curve_scale -= 0.1;
   left_curve_scale = left_curve_scale < 0 ? 0 : left_curve_scale;
+  curve_publish(left_curves, left_curve_active, left_curve_function, left_curve_scale);
+  curve_mutex.give();
+}
+void Drive::r_increase() {
+  curve_mutex.take();
+  right_curve_scale += 0.1;
+  curve_publish(right_curves, right_curve_active, right_curve_function, right_curve_scale);
+  curve_mutex.give();
 }
-void Drive::r_increase() { right_curve_scale += 0.1; }
 void Drive::r_decrease() {
+  curve_mutex.take();
   right_curve_scale -= 0.1;
   right_curve_scale = right_curve_scale < 0 ? 0 : right_curve_scale;
+  curve_publish(right_curves, right_curve_active, right_curve_function, right_curve_scale);
+  curve_mutex.give();
 }
 
 // Button press logic for increase/decrease curves
@@ -157,7 +197,7 @@ void Drive::opcontrol_curve_buttons_toggle(bool toggle) {
   }
   disable_controller = toggle;
   if (!disable_controller)
-    master.set_text(2, 0, "            ");
+    master_display.clear_line(2);
 }
 bool Drive::opcontrol_curve_buttons_toggle_get() { return disable_controller; }
 
@@ -165,43 +205,76 @@ bool Drive::opcontrol_curve_buttons_toggle_get() { return disable_controller; }
 void Drive::opcontrol_curve_buttons_iterate() {
   if (!disable_controller) return;  // True enables, false disables.
 
-  button_press(&l_increase_, master.get_digital(l_increase_.button), ([this] { this->l_increase(); }), ([this] { this->save_l_curve_sd(); }));
-  button_press(&l_decrease_, master.get_digital(l_decrease_.button), ([this] { this->l_decrease(); }), ([this] { this->save_l_curve_sd(); }));
+  button_press(&l_increase_, master_input.digital(l_increase_.button), ([this] { this->l_increase(); }), ([this] { this->save_l_curve_sd(); }));
+  button_press(&l_decrease_, master_input.digital(l_decrease_.button), ([this] { this->l_decrease(); }), ([this] { this->save_l_curve_sd(); }));
   if (!is_tank) {
-    button_press(&r_increase_, master.get_digital(r_increase_.button), ([this] { this->r_increase(); }), ([this] { this->save_r_curve_sd(); }));
-    button_press(&r_decrease_, master.get_digital(r_decrease_.button), ([this] { this->r_decrease(); }), ([this] { this->save_r_curve_sd(); }));
+    button_press(&r_increase_, master_input.digital(r_increase_.button), ([this] { this->r_increase(); }), ([this] { this->save_r_curve_sd(); }));
+    button_press(&r_decrease_, master_input.digital(r_decrease_.button), ([this] { this->r_decrease(); }), ([this] { this->save_r_curve_sd(); }));
   }
 
-  auto sl = util::to_string_with_precision(left_curve_scale, 1);
-  auto sr = util::to_string_with_precision(right_curve_scale, 1);
+  auto sl = util::to_string_with_precision(left_curves[left_curve_active].scale, 1);
+  auto sr = util::to_string_with_precision(right_curves[right_curve_active].scale, 1);
   if (!is_tank)
-    master.set_text(2, 0, sl + "         " + sr);
+    master_display.set_text(2, sl + "         " + sr);
   else
-    master.set_text(2, 0, sl);
+    master_display.set_text(2, sl);
 }
 
-// Left curve function
-double Drive::opcontrol_curve_left(double x) {
-  if (left_curve_scale != 0) {
-    // if (CURVE_TYPE)
-    return (powf(2.718, -(left_curve_scale / 10)) + powf(2.718, (fabs(x) - 127) / 10) * (1 - powf(2.718, -(left_curve_scale / 10)))) * x;
-    // else
-    // return powf(2.718, ((abs(x)-127)*RIGHT_CURVE_SCALE)/100)*x;
+// Curve from 5225A In the Zone
+double Drive::curve_5225a(double x, double scale) {
+  if (scale != 0) {
+    return (powf(2.718, -(scale / 10)) + powf(2.718, (fabs(x) - 127) / 10) * (1 - powf(2.718, -(scale / 10)))) * x;
   }
   return x;
 }
 
-// Right curve function
-double Drive::opcontrol_curve_right(double x) {
-  if (right_curve_scale != 0) {
-    // if (CURVE_TYPE)
-    return (powf(2.718, -(right_curve_scale / 10)) + powf(2.718, (fabs(x) - 127) / 10) * (1 - powf(2.718, -(right_curve_scale / 10)))) * x;
-    // else
-    // return powf(2.718, ((abs(x)-127)*RIGHT_CURVE_SCALE)/100)*x;
-  }
-  return x;
+// Every joystick value goes through the curve once here, so driving only has to look it up
+void Drive::curve_table_build(std::array<double, 255>& table, const std::function<double(double, double)>& curve, double scale) {
+  for (int i = -127; i <= 127; i++)
+    table[i + 127] = curve ? curve(i, scale) : curve_5225a(i, scale);
 }
 
+// Fills the copy opcontrol isn't reading, then makes it the active one.  Callers hold curve_mutex
+void Drive::curve_publish(curve_ (&curves)[2], std::atomic<int>& active, const std::function<double(double, double)>& curve, double scale) {
+  curve_& next = curves[!active];
+  curve_table_build(next.table, curve, scale);
+  next.function = curve;
+  next.scale = scale;
+  active = !active;
+}
+void Drive::curve_tables_build() {
+  curve_mutex.take();
+  curve_publish(left_curves, left_curve_active, left_curve_function, left_curve_scale);
+  curve_publish(right_curves, right_curve_active, right_curve_function, right_curve_scale);
+  curve_mutex.give();
+}
+
+// Joystick values are whole numbers from -127 to 127, anything else is computed
+double Drive::curve_lookup(const curve_& curve, double x) {
+  int index = static_cast<int>(x);
+  if (index == x && index >= -127 && index <= 127) return curve.table[index + 127];
+  return curve.function ? curve.function(x, curve.scale) : curve_5225a(x, curve.scale);
+}
+
+void Drive::opcontrol_curve_left_set(std::function<double(double, double)> curve) {
+  curve_mutex.take();
+  left_curve_function = curve;
+  curve_publish(left_curves, left_curve_active, left_curve_function, left_curve_scale);
+  curve_mutex.give();
+}
+void Drive::opcontrol_curve_right_set(std::function<double(double, double)> curve) {
+  curve_mutex.take();
+  right_curve_function = curve;
+  curve_publish(right_curves, right_curve_active, right_curve_function, right_curve_scale);
+  curve_mutex.give();
+}
+
+// Left curve function
+double Drive::opcontrol_curve_left(double x) { return curve_lookup(left_curves[left_curve_active], x); }
+
+// Right curve function
+double Drive::opcontrol_curve_right(double x) { return curve_lookup(right_curves[right_curve_active], x); }
+
 // Set active brake constant
 void Drive::opcontrol_drive_activebrake_set(double kp, double ki, double kd, double start_i) {
   left_activebrakePID.constants_set(kp, ki, kd, start_i);
@@ -297,12 +370,9 @@ void Drive::opcontrol_tank() {
   // Toggle for controller curve
   opcontrol_curve_buttons_iterate();
 
-  auto analog_left_value = master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y);
-  auto analog_right_value = master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y);
-
   // Put the joysticks through the curve function
-  int l_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
-  int r_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
+  int l_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
+  int r_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
 
   // Set robot to l_stick and r_stick, check joystick threshold, set active brake
   opcontrol_joystick_threshold_iterate(l_stick, r_stick);
@@ -320,12 +390,12 @@ void Drive::opcontrol_arcade_standard(e_type stick_type) {
   // Check arcade type (split vs single, normal vs flipped)
   if (stick_type == SPLIT) {
     // Put the joysticks through the curve function
-    fwd_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
-    turn_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_X)));
+    fwd_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
+    turn_stick = opcontrol_curve_right(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_X)));
   } else if (stick_type == SINGLE) {
     // Put the joysticks through the curve function
-    fwd_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
-    turn_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_X)));
+    fwd_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
+    turn_stick = opcontrol_curve_right(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_X)));
   }
 
   // Set robot to l_stick and r_stick, check joystick threshold, set active brake
@@ -344,14 +414,49 @@ void Drive::opcontrol_arcade_flipped(e_type stick_type) {
   // Check arcade type (split vs single, normal vs flipped)
   if (stick_type == SPLIT) {
     // Put the joysticks through the curve function
-    fwd_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
-    turn_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_X)));
+    fwd_stick = opcontrol_curve_right(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
+    turn_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_X)));
   } else if (stick_type == SINGLE) {
     // Put the joysticks through the curve function
-    fwd_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
-    turn_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_X)));
+    fwd_stick = opcontrol_curve_right(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y)));
+    turn_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_X)));
   }
 
   // Set robot to l_stick and r_stick, check joystick threshold, set active brake
   opcontrol_joystick_threshold_iterate(fwd_stick + turn_stick, fwd_stick - turn_stick);
 }
+
+// Holonomic control
+void Drive::opcontrol_holonomic() {
+  is_tank = false;
+  opcontrol_drive_sensors_reset();
+
+  // Toggle for controller curve
+  opcontrol_curve_buttons_iterate();
+
+  // Put the joysticks through the curve function
+  int fwd_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_Y)));
+  int strafe_stick = opcontrol_curve_left(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_LEFT_X)));
+  int turn_stick = opcontrol_curve_right(clipped_joystick(master_input.analog(pros::E_CONTROLLER_ANALOG_RIGHT_X)));
+
+  // Without strafing this is arcade, so active brake still works when the joysticks are released
+  if (strafe_stick == 0) {
+    opcontrol_joystick_threshold_iterate(fwd_stick + turn_stick, fwd_stick - turn_stick);
+    return;
+  }
+
+  if (practice_mode_is_on && (abs(fwd_stick) > 120 || abs(strafe_stick) > 120 || abs(turn_stick) > 120)) {
+    drive_holonomic_output_set(0, 0, 0);
+    return;
+  }
+
+  // Reversing the drive flips forward and strafe, but turning stays the same
+  if (is_reversed) {
+    fwd_stick = -fwd_stick;
+    strafe_stick = -strafe_stick;
+  }
+
+  // Constrain outputs to the user set max speed
+  double scale = opcontrol_speed_max / 127.0;
+  drive_holonomic_output_set(fwd_stick * scale, strafe_stick * scale, turn_stick * scale);
+}
@@ -0,0 +1,92 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/util.hpp"
+
+using namespace ez;
+
+// How much of each new tracker reading goes into the measured speed, the rest is the last speed
+const double VELOCITY_FILTER = 0.3;
+
+void Drive::pid_drive_velocity_mode_set(bool toggle) { velocity_mode = toggle; }
+bool Drive::pid_drive_velocity_mode_get() { return velocity_mode; }
+
+void Drive::pid_drive_velocity_max_set(double speed) { velocity_max = fabs(speed); }
+void Drive::pid_drive_velocity_max_set(okapi::QSpeed p_speed) { pid_drive_velocity_max_set(p_speed.convert(okapi::inch / okapi::second)); }
+double Drive::pid_drive_velocity_max_get() {
+  if (velocity_max != 0.0) return velocity_max;
+
+  // With integrated encoders, wheel rpm is known so top speed can be calculated
+  if (is_tracker == DRIVE_INTEGRATED)
+    return (CARTRIDGE / RATIO) * WHEEL_DIAMETER * M_PI / 60.0;
+  return 0.0;
+}
+
+void Drive::pid_drive_velocity_constants_set(double p, double i, double d, double p_start_i) {
+  left_velocityPID.constants_set(p, i, d, p_start_i);
+  right_velocityPID.constants_set(p, i, d, p_start_i);
+}
+PID::Constants Drive::pid_drive_velocity_constants_get() { return left_velocityPID.constants_get(); }
+
+void Drive::pid_drive_velocity_feedforward_set(double kv, double ks) {
+  velocity_kv = kv;
+  velocity_ks = ks;
+}
+
+void Drive::private_drive_auto_set(double left, double right) {
+  double top_speed = pid_drive_velocity_max_get();
+  if (!velocity_mode || top_speed == 0.0) {
+    private_drive_set(left, right);
+    return;
+  }
+
+  // If this hasn't run in a while start over from 0
+  std::uint32_t now = pros::millis();
+  bool running = now - velocity_last_time <= util::DELAY_TIME * 2 && now != velocity_last_time;
+  if (!running) {
+    left_velocityPID.variables_reset();
+    right_velocityPID.variables_reset();
+    velocity_left_speed = 0.0;
+    velocity_right_speed = 0.0;
+  }
+
+  if (is_tracker == DRIVE_INTEGRATED) {
+    // The motors measure their own speed in rpm of the cartridge output, which goes to inches per second the same way
+    // encoder counts go to inches
+    double rpm_to_speed = ((50.0 * (3600.0 / CARTRIDGE)) / 60.0) / drive_tick_per_inch();
+    velocity_left_speed = side_motor_get(left_motors, sensor_left).get_actual_velocity() * rpm_to_speed;
+    velocity_right_speed = side_motor_get(right_motors, sensor_right).get_actual_velocity() * rpm_to_speed;
+  } else {
+    // Trackers don't measure speed, so it's the change in position over time.  Tick timing jitters by a ms or two,
+    // which is a lot of noise over 10ms, so the difference is filtered
+    double l_sensor = drive_sensor_left();
+    double r_sensor = drive_sensor_right();
+    if (running) {
+      double dt = (now - velocity_last_time) / 1000.0;
+      velocity_left_speed += (((l_sensor - velocity_last_left) / dt) - velocity_left_speed) * VELOCITY_FILTER;
+      velocity_right_speed += (((r_sensor - velocity_last_right) / dt) - velocity_right_speed) * VELOCITY_FILTER;
+    }
+    velocity_last_left = l_sensor;
+    velocity_last_right = r_sensor;
+  }
+  velocity_last_time = now;
+  double l_speed = velocity_left_speed;
+  double r_speed = velocity_right_speed;
+
+  // The outer loops output -127 to 127, which maps to -top speed to top speed
+  double l_target = (left / 127.0) * top_speed;
+  double r_target = (right / 127.0) * top_speed;
+
+  // Feedforward gets close, and the velocity PID fixes the rest
+  double kv = velocity_kv != 0.0 ? velocity_kv : 127.0 / top_speed;
+  left_velocityPID.target_set(l_target);
+  right_velocityPID.target_set(r_target);
+  double l_out = (l_target * kv) + (util::sgn(l_target) * velocity_ks) + left_velocityPID.compute(l_speed);
+  double r_out = (r_target * kv) + (util::sgn(r_target) * velocity_ks) + right_velocityPID.compute(r_speed);
+
+  private_drive_set(util::clamp(l_out, 127.0), util::clamp(r_out, 127.0));
+}
@@ -117,6 +117,8 @@ std::string exit_to_string(exit_output input) {
       return "mA";
     case ERROR_NO_CONSTANTS:
       return "Error: Exit condition constants not set!";
+    case CANCEL_EXIT:
+      return "Cancelled";
     default:
       return "Error: Out of bounds!";
   }
@@ -187,52 +189,18 @@ double absolute_angle_to_point(pose itarget, pose icurrent) {
 
 // Outputs a target that will get you there the fastest
 double turn_shortest(double target, double current, bool print) {
-  if (print) printf("SHORTEST   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double error = target - current;
-  if (fabs(error) < 180.0) {
-    if (print) printf("%.2f\n", target);
-    return target;
-  }
-  double new_target = target;
-
-  while (error > 180) {
-    new_target -= 360;
-    error = new_target - current;
-  }
-  while (error < -180) {
-    new_target += 360;
-    error = new_target - current;
-  }
-
-  if (new_target - current == 0.0) {
-    if (print) printf("%.2f\n", target);
-    return current;
-  }
-
-  if (print) printf("%.2f\n", new_target);
+  double new_target = angle_shortest(target, current);
+  if (print) printf("SHORTEST   Target: %.2f   Current: %.2f      New Target: %.2f\n", target, current, new_target);
   return new_target;
 }
 
 // Outputs a target that will get you there the slowest
 double turn_longest(double target, double current, bool print) {
-  if (print) printf("LONGEST   Target: %.2f   Current: %.2f      New Target: ", target, current);
-  double shortest_target = turn_shortest(target, current, false);
-  double new_target = target;
-
-  double error = shortest_target - current;
-  new_target = shortest_target - (360 * util::sgn(error));
-
-  if (print) printf("%.2f\n", new_target);
+  double new_target = angle_longest(target, current);
+  if (print) printf("LONGEST   Target: %.2f   Current: %.2f      New Target: %.2f\n", target, current, new_target);
   return new_target;
 }
 
-// Outputs angle within 180 t0 -180
-double wrap_angle(double theta) {
-  while (theta > 180) theta -= 360;
-  while (theta < -180) theta += 360;
-  return theta;
-}
-
 // Find shortest distance to point
 double distance_to_point(pose itarget, pose icurrent) {
   // Difference in target to current (legs of triangle)
@@ -67,52 +67,68 @@ void driveOff() {
   chassis.pid_wait();
 }
 
-void rightHold() {
-  stopPiston.set(false);
-  bottomRollers.move(127);
-  topRollers.move(127);
-  topIntake.move(127);
+// rightHold() runs the drive path and the intake side by side.  They hand off through stage:
+// 1 once the drive is done loading, 2 once it's backed into the goal, and 3 once the intake is done scoring
+ez::co::routine rightHoldDrive(int& stage) {
   chassis.pid_drive_set(19.5_in, DRIVE_SPEED, true);
-  pros::delay(500);
+  co_await ez::co::delay(500);
   chassis.pid_turn_set(35_deg, TURN_SPEED);
-  pros::delay(300);
+  co_await ez::co::delay(300);
   chassis.pid_drive_set(13_in, 110, true);
-  pros::delay(300);
+  co_await ez::co::delay(300);
   matchLoader.set(true);
   chassis.pid_drive_set(9_in, 1110, true);
-  pros::delay(500);
+  co_await ez::co::delay(500);
   matchLoader.set(false);
   chassis.pid_turn_set(130_deg, TURN_SPEED);
-  pros::delay(450);
+  co_await ez::co::delay(450);
   chassis.pid_drive_set(42.5_in, DRIVE_SPEED, true); // going to goal
-  pros::delay(1000);
+  co_await ez::co::delay(1000);
   chassis.pid_turn_set(181_deg, DRIVE_SPEED);
   matchLoader.set(true);
-  pros::delay(480);
+  co_await ez::co::delay(480);
   chassis.pid_drive_set(23_in, 80, true); // match loading
-  pros::delay(1100);
-  bottomRollers.move(0);
+  co_await ez::co::delay(1100);
+  stage = 1;
   chassis.pid_drive_set(-42.3_in, 90, true); // scoring
-  pros::delay(800);
-  stopPiston.set(true);
+  co_await ez::co::delay(800);
   matchLoader.set(false);
+  stage = 2;
+  co_await ez::co::until([&stage]() { return stage == 3; });
+  chassis.pid_turn_set(250_deg, TURN_SPEED);
+  co_await ez::co::delay(450);
+  chassis.pid_drive_set(11.7_in, DRIVE_SPEED);
+  co_await ez::co::delay(500);
+  chassis.pid_turn_set(180_deg, TURN_SPEED);
+  co_await ez::co::delay(400);
+  ez::motion_handle park = chassis.pid_drive_set(-34_in, DRIVE_SPEED, true);
+  co_await ez::co::delay(1000);
+  chassis.drive_brake_set(MOTOR_BRAKE_HOLD);
+  co_await park;
+}
+
+ez::co::routine rightHoldIntake(int& stage) {
+  stopPiston.set(false);
   bottomRollers.move(127);
   topRollers.move(127);
   topIntake.move(127);
-  pros::delay(2000);
-  chassis.pid_turn_set(250_deg, TURN_SPEED);
+  co_await ez::co::until([&stage]() { return stage >= 1; });
+  bottomRollers.move(0);
+  co_await ez::co::until([&stage]() { return stage >= 2; });
+  stopPiston.set(true);
+  bottomRollers.move(127);
+  topRollers.move(127);
+  topIntake.move(127);
+  co_await ez::co::delay(2000);
   bottomRollers.move(0);
   topRollers.move(0);
   topIntake.move(0);
-  pros::delay(450);
-  chassis.pid_drive_set(11.7_in, DRIVE_SPEED);
-  pros::delay(500);
-  chassis.pid_turn_set(180_deg, TURN_SPEED);
-  pros::delay(400);
-  chassis.pid_drive_set(-34_in, DRIVE_SPEED, true);
-  pros::delay(1000);
-  chassis.drive_brake_set(MOTOR_BRAKE_HOLD);
-  chassis.pid_wait();
+  stage = 3;
+}
+
+void rightHold() {
+  int stage = 0;
+  ez::co::run(chassis, rightHoldDrive(stage), rightHoldIntake(stage));
 }
 
 void leftHold() {
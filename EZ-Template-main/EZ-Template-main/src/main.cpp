@@ -26,8 +26,6 @@ void initialize() {
   // Print our branding over your terminal :D
   ez::ez_template_print();
 
-  pros::delay(500);  // Stop the user from doing anything while legacy ports configure
-
   // Configure your chassis controls
   chassis.opcontrol_curve_buttons_toggle(true);   // Enables modifying the controller curve with buttons on the joysticks
   chassis.opcontrol_drive_activebrake_set(0.0);   // Sets the active brake kP. We recommend ~2.  0 will disable.
@@ -52,10 +50,10 @@ void initialize() {
       {"Right four ball autonomous\n\nRight side auto that gets four balls into long goal with descore", right4Ball},
   });
 
-  // Initialize chassis and auton selector
+  // Initialize chassis and auton selector.  The chassis calibrates in the background so the selector works right away
   chassis.initialize();
   ez::as::initialize();
-  master.rumble(chassis.drive_imu_calibrated() ? "." : "---");
+  pros::Task([]() { ez::master_display.rumble(chassis.drive_initialize_wait() ? "." : "---"); });
   pros::lcd::initialize();
 }
 
@@ -94,6 +92,7 @@ void competition_initialize() {
  * from where it left off.
  */
 void autonomous() {
+  chassis.drive_initialize_wait();            // Waits for the IMU to finish calibrating if it hasn't yet
   chassis.pid_targets_reset();                // Resets PID targets to 0
   chassis.drive_imu_reset();                  // Reset gyro position to 0
   chassis.drive_sensor_reset();               // Reset drive sensors to 0
@@ -179,16 +178,25 @@ void ez_template_extras() {
     //  When enabled:
     //  * use A and Y to increment / decrement the constants
     //  * use the arrow keys to navigate the constants
-    if (master.get_digital_new_press(DIGITAL_X))
+    if (ez::master_input.digital_new_press(DIGITAL_X))
       chassis.pid_tuner_toggle();
 
     // Trigger the selected autonomous routine
-    if (master.get_digital(DIGITAL_B) && master.get_digital(DIGITAL_DOWN)) {
+    if (ez::master_input.digital(DIGITAL_B) && ez::master_input.digital(DIGITAL_DOWN)) {
       pros::motor_brake_mode_e_t preference = chassis.drive_brake_get();
       autonomous();
       chassis.drive_brake_set(preference);
     }
 
+    // Calibrate the IMU scaler, the result is saved to the SD card and loaded every time the robot turns on
+    //  * with a left and right tracking wheel, put the robot anywhere with room to spin
+    //  * without them, put the back of the robot against a wall
+    if (ez::master_input.digital(DIGITAL_B) && ez::master_input.digital(DIGITAL_UP) && !chassis.pid_tuner_enabled()) {
+      pros::motor_brake_mode_e_t preference = chassis.drive_brake_get();
+      chassis.drive_imu_scaler_calibrate();
+      chassis.drive_brake_set(preference);
+    }
+
     // Allow PID Tuner to iterate
     chassis.pid_tuner_iterate();
   }
@@ -212,6 +220,8 @@ void opcontrol() {
   chassis.drive_brake_set(MOTOR_BRAKE_COAST);
   static uint32_t lastPrint = 0;
   while (true) {
+    ez::master_input.update();  // Reads the controller once, everything below uses this snapshot
+
     uint32_t now = pros::millis();
     if (now - lastPrint >= 200) {   // 200 ms
       lastPrint = now;
@@ -223,10 +233,10 @@ void opcontrol() {
     ez_template_extras();
     chassis.opcontrol_arcade_standard(ez::SPLIT);
     // pneumatics
-    descore.button_toggle(master.get_digital(DIGITAL_B));
-    matchLoader.button_toggle(master.get_digital(DIGITAL_DOWN));
-    stopPiston.button_toggle(master.get_digital(DIGITAL_Y));
-    // if (master.get_digital(DIGITAL_X)) {
+    descore.button_toggle(ez::master_input.digital(DIGITAL_B));
+    matchLoader.button_toggle(ez::master_input.digital(DIGITAL_DOWN));
+    stopPiston.button_toggle(ez::master_input.digital(DIGITAL_Y));
+    // if (ez::master_input.digital(DIGITAL_X)) {
     //   stopPiston.set(false);
     //   bottomRollers.move(127);
     //   topRollers.move(127);
@@ -266,27 +276,27 @@ void opcontrol() {
     //   chassis.pid_turn_set(43_deg, 100);
     // }
     // intake logic
-    if (master.get_digital(DIGITAL_R1)) { //scoring on the top
+    if (ez::master_input.digital(DIGITAL_R1)) { //scoring on the top
       topRollers.move(127);
       topIntake.move(127);
-      if (master.get_digital(DIGITAL_L1)) { // picking balls from floor
+      if (ez::master_input.digital(DIGITAL_L1)) { // picking balls from floor
         bottomRollers.move(127);
       }
       else {
         bottomRollers.move(0);
       }
     }
-    else if (master.get_digital(DIGITAL_R2)) {
+    else if (ez::master_input.digital(DIGITAL_R2)) {
       topRollers.move(100);
       topIntake.move(-100);
     }
-    else if (master.get_digital(DIGITAL_L1)) { // picking up from floor
+    else if (ez::master_input.digital(DIGITAL_L1)) { // picking up from floor
       bottomRollers.move(127);
-      if (master.get_digital(DIGITAL_R1)) { // scoring on top goal
+      if (ez::master_input.digital(DIGITAL_R1)) { // scoring on top goal
         topRollers.move(127);
         topIntake.move(127);
       }
-      else if (master.get_digital(DIGITAL_R2)) { // scoring on middle top 
+      else if (ez::master_input.digital(DIGITAL_R2)) { // scoring on middle top 
         topRollers.move(90);
         topIntake.move(-90);
       }
@@ -295,7 +305,7 @@ void opcontrol() {
         topIntake.move(0);
       }
     }
-    else if (master.get_digital(DIGITAL_L2)) { // removing balls from bot
+    else if (ez::master_input.digital(DIGITAL_L2)) { // removing balls from bot
       bottomRollers.move(-127);
       topRollers.move(-127);
       topIntake.move(-127);